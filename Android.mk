@@ -93,6 +93,7 @@ LOCAL_SRC_FILES := \
         src/armnn/Network.cpp \
         src/armnn/NetworkUtils.cpp \
         src/armnn/Observable.cpp \
+        src/armnn/OptimizedNetworkCache.cpp \
         src/armnn/Optimizer.cpp \
         src/armnn/optimizations/PermuteAndBatchToSpaceAsDepthToSpace.cpp \
         src/armnn/ProfilingEvent.cpp \
@@ -102,12 +103,15 @@ LOCAL_SRC_FILES := \
         src/armnn/SubgraphView.cpp \
         src/armnn/SubgraphViewSelector.cpp \
         src/armnn/Tensor.cpp \
+        src/armnn/Threadpool.cpp \
         src/armnn/TypesUtils.cpp \
         src/armnn/Utils.cpp \
         src/armnn/WallClockTimer.cpp \
+        src/armnn/WorkingMemHandle.cpp \
         src/armnnUtils/CsvReader.cpp \
         src/armnnUtils/DataLayoutIndexed.cpp \
         src/armnnUtils/DotSerializer.cpp \
+        src/armnnUtils/FileMapping.cpp \
         src/armnnUtils/FloatingPointConverter.cpp \
         src/armnnUtils/HeapProfiling.cpp \
         src/armnnUtils/LeakChecking.cpp \
@@ -14,6 +14,7 @@
 #include <armnn/Deprecated.hpp>
 
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace armnn
@@ -364,7 +365,8 @@ public:
     /// the passed in constant tensor.
     /// @param input - Tensor to be provided as the only output of the layer. The layer will maintain
     ///                its own copy of the tensor data, meaning the memory referenced by @a input can
-    ///                be freed or reused after this function is called.
+    ///                be freed or reused after this function is called, unless the data lies in memory
+    ///                shared with ShareConstantMemory().
     /// @param name - Optional name for the layer.
     /// @return - Interface for configuring the layer.
     virtual IConnectableLayer* AddConstantLayer(const ConstTensor& input,
@@ -528,6 +530,15 @@ public:
 
     virtual void Accept(ILayerVisitor& visitor) const = 0;
 
+    /// Makes the layers added afterwards refer to the constant tensor data lying in [data, data + numBytes) rather
+    /// than keep their own copies, which saves memory when the data is already loaded, e.g. in a mapped model file.
+    /// The networks optimized from this network and the workloads created from them refer to it too. The memory is
+    /// only ever read, and may be read-only: a constant tensor which is modified is copied first.
+    /// @param sharedMemory - Keeps the memory alive while it is referred to.
+    /// @param data - Start of the memory.
+    /// @param numBytes - Size of the memory.
+    virtual void ShareConstantMemory(std::shared_ptr<void> sharedMemory, const void* data, size_t numBytes) = 0;
+
 protected:
     ~INetwork() {}
 };
@@ -565,6 +576,11 @@ struct OptimizerOptions
 
     // Add debug data for easier troubleshooting
     bool m_Debug;
+
+    // If not empty, the directory in which the backend assignment and tensor handle strategies chosen for a network
+    // are stored, to be reused when the same network is optimized again for the same backends and options, e.g. by
+    // another process. Not used when m_Debug is set.
+    std::string m_CacheDirectory;
 };
 
 /// Create an optimized version of the network
@@ -7,10 +7,13 @@
 
 #include "INetwork.hpp"
 #include "IProfiler.hpp"
+#include "IWorkingMemHandle.hpp"
 #include "Tensor.hpp"
 #include "Types.hpp"
 #include "TypesUtils.hpp"
 
+#include <functional>
+#include <future>
 #include <memory>
 
 namespace armnn
@@ -23,6 +26,11 @@ class IGpuAccTunedParameters;
 class IRuntime;
 using IRuntimePtr = std::unique_ptr<IRuntime, void(*)(IRuntime* runtime)>;
 
+/// Define the type of callback notified of the completion of an inference scheduled with
+/// IRuntime::EnqueueWorkloadAsync(). It is called from one of the worker threads of the runtime.
+/// @param status - The result of the inference
+using AsyncExecutionCallback = std::function<void(Status status)>;
+
 struct INetworkProperties
 {
     INetworkProperties(bool importEnabled = false, bool exportEnabled = false)
@@ -35,6 +43,20 @@ struct INetworkProperties
     virtual ~INetworkProperties() {}
 };
 
+/// The working memory of the intermediate tensors of a loaded network, as laid out by the backends.
+struct WorkingMemoryStatistics
+{
+    WorkingMemoryStatistics(size_t plannedBytes = 0, size_t managedBytes = 0)
+        : m_PlannedBytes(plannedBytes),
+          m_ManagedBytes(managedBytes) {}
+
+    /// The memory reserved for the tensors, in which tensors whose lifetimes don't overlap share bytes.
+    size_t m_PlannedBytes;
+
+    /// The memory the tensors would take if each had its own.
+    size_t m_ManagedBytes;
+};
+
 class IRuntime
 {
 public:
@@ -44,6 +66,9 @@ public:
             : m_GpuAccTunedParameters(nullptr)
             , m_EnableGpuProfiling(false)
             , m_DynamicBackendsPath("")
+            , m_AsyncExecutionThreads(0)
+            , m_AsyncQueueCapacity(64)
+            , m_CpuRefNumThreads(1)
         {}
 
         /// If set, uses the GpuAcc tuned parameters from the given object when executing GPU workloads.
@@ -57,6 +82,18 @@ public:
         // Only a single path is allowed for the override
         std::string m_DynamicBackendsPath;
 
+        // Number of worker threads running the inferences scheduled with EnqueueWorkloadAsync().
+        // If zero, one thread per hardware thread is used. The threads are only started on the first call.
+        unsigned int m_AsyncExecutionThreads;
+
+        // Maximum number of inferences waiting to be run. EnqueueWorkloadAsync() blocks while this many are queued.
+        unsigned int m_AsyncQueueCapacity;
+
+        // Number of threads the CpuRef Convolution2d, DepthwiseConvolution2d and FullyConnected kernels are split
+        // across. If zero, one thread per hardware thread is used. Each runtime has its own pool of threads, shared
+        // by the networks it loads.
+        unsigned int m_CpuRefNumThreads;
+
         struct ExternalProfilingOptions
         {
             ExternalProfilingOptions()
@@ -111,6 +148,36 @@ public:
                                    const InputTensors& inputTensors,
                                    const OutputTensors& outputTensors) = 0;
 
+    /// Schedules an evaluation of a network on the worker threads of the runtime and returns immediately,
+    /// unless the request queue is full in which case it blocks until a request has been taken off the queue.
+    /// Higher priority requests are run first. The tensors must remain valid until the returned future is ready,
+    /// and the requests for a network must have completed before it is unloaded.
+    /// @return A future receiving the result of the inference once its outputs have been written.
+    virtual std::future<Status> EnqueueWorkloadAsync(NetworkId networkId,
+                                                     const InputTensors& inputTensors,
+                                                     const OutputTensors& outputTensors,
+                                                     QosExecPriority priority = QosExecPriority::Medium) = 0;
+
+    /// Schedules an evaluation of a network like the overload above, calling callback on completion instead.
+    virtual void EnqueueWorkloadAsync(NetworkId networkId,
+                                      const InputTensors& inputTensors,
+                                      const OutputTensors& outputTensors,
+                                      const AsyncExecutionCallback& callback,
+                                      QosExecPriority priority = QosExecPriority::Medium) = 0;
+
+    /// Creates the working memory needed to run one inference of a network through Execute().
+    /// Only networks whose layers are all assigned to backends supporting asynchronous execution are accepted.
+    /// @param [in] networkId - Unique identifier of the network, generated in LoadNetwork().
+    /// @return The working memory, which must not outlive the network it was created for.
+    virtual std::unique_ptr<IWorkingMemHandle> CreateWorkingMemHandle(NetworkId networkId) = 0;
+
+    /// Evaluates a network using input in inputTensors and outputs filled into outputTensors, keeping all the
+    /// intermediate results in workingMemHandle. Unlike EnqueueWorkload(), calls made with different working
+    /// memory handles run concurrently.
+    virtual Status Execute(IWorkingMemHandle& workingMemHandle,
+                           const InputTensors& inputTensors,
+                           const OutputTensors& outputTensors) = 0;
+
     /// Unloads a network from the IRuntime.
     /// At the moment this only removes the network from the m_Impl->m_Network.
     /// This might need more work in the future to be AndroidNN compliant.
@@ -120,6 +187,11 @@ public:
 
     virtual const IDeviceSpec& GetDeviceSpec() const = 0;
 
+    /// Gets the working memory the backends planned for the intermediate tensors of a network when loading it. The
+    /// working memory of the handles created by CreateWorkingMemHandle() is reported by the handles themselves.
+    /// @param networkId The id of the network.
+    virtual WorkingMemoryStatistics GetWorkingMemoryStatistics(NetworkId networkId) const = 0;
+
     /// Gets the profiler corresponding to the given network id.
     /// @param networkId The id of the network for which to get the profile.
     /// @return A pointer to the requested profiler, or nullptr if not found.
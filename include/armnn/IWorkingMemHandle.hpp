@@ -0,0 +1,32 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace armnn
+{
+
+using NetworkId = int;
+
+/// Working memory for one inference of a loaded network: the intermediate tensors of every layer along with
+/// the bindings of the network inputs and outputs. The constant tensors of the network are not duplicated.
+/// Inferences using different handles can run on the same network at the same time, whereas a single handle
+/// must not be used by more than one inference at a time.
+class IWorkingMemHandle
+{
+public:
+    virtual ~IWorkingMemHandle() {}
+
+    /// Returns the id of the network this working memory was created for.
+    virtual NetworkId GetNetworkId() const = 0;
+
+    /// Returns the number of bytes of tensor data owned by this working memory, in which the tensors whose
+    /// lifetimes don't overlap share memory.
+    virtual size_t GetSizeInBytes() const = 0;
+};
+
+} // namespace armnn
@@ -126,6 +126,14 @@ enum class OutputShapeRounding
     Ceiling     = 1
 };
 
+/// Priority of an inference scheduled with IRuntime::EnqueueWorkloadAsync().
+enum class QosExecPriority
+{
+    Low    = 0,
+    Medium = 1,
+    High   = 2
+};
+
 /// Each backend should implement an IBackend.
 class IBackend
 {
@@ -37,6 +37,12 @@ public:
     /// Create an input network from a binary input stream
     virtual armnn::INetworkPtr CreateNetworkFromBinary(std::istream& binaryContent) = 0;
 
+    /// Create an input network from a binary file. The file is memory-mapped instead of read, and the constant
+    /// tensors of the network and of the networks optimized from it refer to the mapping instead of copies of
+    /// their data, so the page cache holding them is shared with other processes using the same file.
+    /// The file must not be modified while the network or any network optimized from it is in use.
+    virtual armnn::INetworkPtr CreateNetworkFromBinaryFile(const char* fileName) = 0;
+
     /// Retrieve binding info (layer id and tensor info) for the network input identified by
     /// the given layer name and layers id
     virtual BindingPointInfo GetNetworkInputBindingInfo(unsigned int layerId,
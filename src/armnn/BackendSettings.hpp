@@ -5,7 +5,13 @@
 
 #pragma once
 
+#include "DeviceSpec.hpp"
+
 #include <armnn/BackendId.hpp>
+
+#include <boost/cast.hpp>
+
+#include <algorithm>
 #include <vector>
 
 namespace armnn
@@ -10,6 +10,7 @@
 #include "Runtime.hpp"
 #include "Profiling.hpp"
 #include "HeapProfiling.hpp"
+#include "WorkingMemHandle.hpp"
 
 #include <armnn/BackendRegistry.hpp>
 
@@ -17,6 +18,7 @@
 #include <backendsCommon/IMemoryManager.hpp>
 #include <backendsCommon/MemCopyWorkload.hpp>
 #include <backendsCommon/MemSyncWorkload.hpp>
+#include <backendsCommon/WorkloadUtils.hpp>
 
 #include <boost/polymorphic_cast.hpp>
 #include <boost/assert.hpp>
@@ -43,7 +45,8 @@ std::string ToErrorMessage(const char * prefix, const ExceptionType & error)
 
 std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
                                                                 std::string& errorMessage,
-                                                                const INetworkProperties& networkProperties)
+                                                                const INetworkProperties& networkProperties,
+                                                                const BackendContexts& backendContexts)
 {
     std::unique_ptr<LoadedNetwork> loadedNetwork;
 
@@ -57,7 +60,7 @@ std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<
 
     try
     {
-        loadedNetwork.reset(new LoadedNetwork(std::move(net), networkProperties));
+        loadedNetwork.reset(new LoadedNetwork(std::move(net), networkProperties, backendContexts));
     }
     catch (const armnn::RuntimeException& error)
     {
@@ -76,7 +79,8 @@ std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<
 }
 
 LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
-                             const INetworkProperties& networkProperties) :
+                             const INetworkProperties& networkProperties,
+                             const BackendContexts& backendContexts) :
                              m_OptimizedNetwork(std::move(net)),
                              m_IsImportEnabled(networkProperties.m_ImportEnabled),
                              m_IsExportEnabled(networkProperties.m_ExportEnabled)
@@ -100,6 +104,12 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
 
             IBackendInternal* backend = it.first->second.get();
 
+            auto context = backendContexts.find(backendId);
+            if (context != backendContexts.end())
+            {
+                backend->SetBackendContext(*context->second);
+            }
+
             if (backend->SupportsTensorAllocatorAPI())
             {
                 backend->RegisterTensorHandleFactories(m_TensorHandleFactoryRegistry);
@@ -176,6 +186,7 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
                 }
 
                 m_WorkloadQueue.push_back(move(workload));
+                m_WorkloadLayers.push_back(layer);
                 // release the constant data in the layer..
                 layer->ReleaseConstantData();
                 break;
@@ -186,6 +197,18 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
     // Set up memory.
     m_OptimizedNetwork->GetGraph().AllocateDynamicBuffers();
 
+    // The lifetimes of the intermediate tensors are now known, so their memory can be planned before the first
+    // inference.
+    for (auto&& workloadFactory : m_WorkloadFactories)
+    {
+        IBackendInternal::IMemoryManagerSharedPtr memoryManager = workloadFactory.second.second;
+        if (memoryManager)
+        {
+            memoryManager->PlanMemory();
+        }
+    }
+    m_TensorHandleFactoryRegistry.PlanMemory();
+
     // Now that the intermediate tensor memory has been set-up, do any post allocation configuration for each workload.
     for (auto& workload : m_WorkloadQueue)
     {
@@ -347,6 +370,8 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "EnqueueWorkload");
 
+    std::lock_guard<std::mutex> lockGuard(m_EnqueueWorkloadMutex);
+
     const Graph& graph = m_OptimizedNetwork->GetGraph();
 
     // Walk graph to determine the order of execution.
@@ -552,7 +577,7 @@ void LoadedNetwork::AllocateWorkingMemory()
 
 void LoadedNetwork::FreeWorkingMemory()
 {
-    std::lock_guard<std::mutex> lockGuard(m_WorkingMemMutex);
+    std::lock_guard<std::shared_timed_mutex> lockGuard(m_WorkingMemMutex);
     if (!m_IsWorkingMemAllocated)
     {
         return;
@@ -582,7 +607,7 @@ bool LoadedNetwork::Execute()
 
     try
     {
-        std::lock_guard<std::mutex> lockGuard(m_WorkingMemMutex);
+        std::lock_guard<std::shared_timed_mutex> lockGuard(m_WorkingMemMutex);
         AllocateWorkingMemory();
 
         for (auto& input : m_InputQueue)
@@ -612,6 +637,250 @@ bool LoadedNetwork::Execute()
     return success;
 }
 
+std::unique_ptr<IWorkingMemHandle> LoadedNetwork::CreateWorkingMemHandle(NetworkId networkId)
+{
+    for (auto&& backend : m_Backends)
+    {
+        if (!backend.second->SupportsAsyncExecution())
+        {
+            throw InvalidArgumentException(boost::str(
+                boost::format("CreateWorkingMemHandle: backend %1% does not support asynchronous execution")
+                % backend.first.Get()));
+        }
+    }
+
+    const Graph& graph = m_OptimizedNetwork->GetGraph();
+
+    // The working memory has its own memory managers, so that its tensors are planned like the ones of the network
+    // but don't share memory with them or with other working memories.
+    auto tensorHandleFactoryRegistry = std::make_unique<TensorHandleFactoryRegistry>();
+    std::vector<IBackendInternal::IMemoryManagerSharedPtr> memoryManagers;
+    std::unordered_map<BackendId, IBackendInternal::IWorkloadFactoryPtr> workloadFactories;
+    for (auto&& backend : m_Backends)
+    {
+        if (backend.second->SupportsTensorAllocatorAPI())
+        {
+            backend.second->RegisterTensorHandleFactories(*tensorHandleFactoryRegistry);
+            workloadFactories[backend.first] = backend.second->CreateWorkloadFactory(*tensorHandleFactoryRegistry);
+        }
+        else
+        {
+            IBackendInternal::IMemoryManagerSharedPtr memoryManager = backend.second->CreateMemoryManager();
+            workloadFactories[backend.first] = backend.second->CreateWorkloadFactory(memoryManager);
+            if (memoryManager)
+            {
+                memoryManagers.push_back(memoryManager);
+            }
+        }
+    }
+
+    std::unordered_map<const OutputSlot*, ITensorHandle*> tensorHandleMap;
+    std::vector<std::unique_ptr<ITensorHandle>> tensorHandles;
+
+    // The number of workloads still to read each tensor. The lifetime of a tensor ends when it drops to zero, so
+    // the tensors read by the output layers, which are copied out after all the workloads ran, live until the end.
+    std::unordered_map<const ITensorHandle*, unsigned int> numPendingReaders;
+
+    auto createOutputTensorHandles = [&](const Layer& layer)
+    {
+        for (auto&& slot : layer.GetOutputSlots())
+        {
+            const ITensorHandle* networkTensorHandle = slot.GetOutputHandler().GetData();
+            if (networkTensorHandle != nullptr && networkTensorHandle->GetParent() != nullptr)
+            {
+                throw InvalidArgumentException(boost::str(
+                    boost::format("CreateWorkingMemHandle: sub-tensors are not supported (layer: '%1%')")
+                    % layer.GetNameStr()));
+            }
+
+            const TensorInfo& tensorInfo = slot.GetTensorInfo();
+            ITensorHandleFactory::FactoryId factoryId = slot.GetTensorHandleFactoryId();
+
+            // The output of a MemImport layer is pointed at the memory of its input on every execution.
+            const bool isMemoryManaged = layer.GetType() != LayerType::MemImport;
+
+            std::unique_ptr<ITensorHandle> tensorHandle;
+            if (factoryId == ITensorHandleFactory::LegacyFactoryId)
+            {
+                tensorHandle = workloadFactories.at(layer.GetBackendId())->CreateTensorHandle(tensorInfo,
+                                                                                              isMemoryManaged);
+            }
+            else
+            {
+                ITensorHandleFactory* handleFactory = tensorHandleFactoryRegistry->GetFactory(factoryId);
+                BOOST_ASSERT(handleFactory);
+                tensorHandle = handleFactory->CreateTensorHandle(tensorInfo, isMemoryManaged);
+            }
+
+            if (isMemoryManaged)
+            {
+                tensorHandle->Manage();
+
+                unsigned int numReaders = 0;
+                for (const InputSlot* connection : slot.GetConnections())
+                {
+                    if (connection->GetOwningLayer().GetType() == LayerType::Output)
+                    {
+                        numReaders = 0;
+                        break;
+                    }
+                    ++numReaders;
+                }
+                if (numReaders > 0)
+                {
+                    numPendingReaders[tensorHandle.get()] = numReaders;
+                }
+            }
+
+            tensorHandleMap[&slot] = tensorHandle.get();
+            tensorHandles.push_back(std::move(tensorHandle));
+        }
+    };
+
+    std::unordered_map<LayerBindingId, ITensorHandle*> inputHandles;
+    for (const BindableLayer* inputLayer : graph.GetInputLayers())
+    {
+        createOutputTensorHandles(*inputLayer);
+        inputHandles[inputLayer->GetBindingId()] = tensorHandleMap.at(&inputLayer->GetOutputSlot(0));
+    }
+
+    // The workloads are stored in topological order, so the tensors a layer reads have always been created already.
+    std::vector<WorkingMemDescriptor> workingMemDescriptors;
+    workingMemDescriptors.reserve(m_WorkloadLayers.size());
+    for (const Layer* layer : m_WorkloadLayers)
+    {
+        createOutputTensorHandles(*layer);
+
+        WorkingMemDescriptor workingMemDescriptor;
+        for (auto&& slot : layer->GetInputSlots())
+        {
+            ITensorHandle* tensorHandle = tensorHandleMap.at(slot.GetConnectedOutputSlot());
+            workingMemDescriptor.m_Inputs.push_back(tensorHandle);
+
+            auto pendingReaders = numPendingReaders.find(tensorHandle);
+            if (pendingReaders != numPendingReaders.end() && --pendingReaders->second == 0)
+            {
+                // Ends the lifetime of the tensor, letting the memory manager give its memory to later tensors.
+                tensorHandle->Allocate();
+                numPendingReaders.erase(pendingReaders);
+            }
+        }
+        for (auto&& slot : layer->GetOutputSlots())
+        {
+            workingMemDescriptor.m_Outputs.push_back(tensorHandleMap.at(&slot));
+        }
+        workingMemDescriptors.push_back(std::move(workingMemDescriptor));
+    }
+
+    std::unordered_map<LayerBindingId, ITensorHandle*> outputHandles;
+    for (const BindableLayer* outputLayer : graph.GetOutputLayers())
+    {
+        outputHandles[outputLayer->GetBindingId()] =
+            tensorHandleMap.at(outputLayer->GetInputSlot(0).GetConnectedOutputSlot());
+    }
+
+    return std::make_unique<WorkingMemHandle>(networkId,
+                                              std::move(workingMemDescriptors),
+                                              std::move(inputHandles),
+                                              std::move(outputHandles),
+                                              std::move(tensorHandles),
+                                              std::move(tensorHandleFactoryRegistry),
+                                              std::move(memoryManagers));
+}
+
+WorkingMemoryStatistics LoadedNetwork::GetWorkingMemoryStatistics() const
+{
+    WorkingMemoryStatistics statistics(m_TensorHandleFactoryRegistry.GetPlannedBytes(),
+                                       m_TensorHandleFactoryRegistry.GetManagedBytes());
+    for (auto&& workloadFactory : m_WorkloadFactories)
+    {
+        IBackendInternal::IMemoryManagerSharedPtr memoryManager = workloadFactory.second.second;
+        if (memoryManager)
+        {
+            statistics.m_PlannedBytes += memoryManager->GetPlannedBytes();
+            statistics.m_ManagedBytes += memoryManager->GetManagedBytes();
+        }
+    }
+    return statistics;
+}
+
+Status LoadedNetwork::Execute(const InputTensors& inputTensors,
+                              const OutputTensors& outputTensors,
+                              IWorkingMemHandle& iWorkingMemHandle)
+{
+    const Graph& graph = m_OptimizedNetwork->GetGraph();
+
+    if (graph.GetNumLayers() < 2)
+    {
+        BOOST_LOG_TRIVIAL(warning) << "IRuntime::Execute()::Less than two nodes in graph";
+        return Status::Failure;
+    }
+
+    if (graph.GetNumInputs() != inputTensors.size())
+    {
+        throw InvalidArgumentException("Number of inputs provided does not match network.");
+    }
+
+    if (graph.GetNumOutputs() != outputTensors.size())
+    {
+        throw InvalidArgumentException("Number of outputs provided does not match network.");
+    }
+
+    WorkingMemHandle& workingMemHandle = *boost::polymorphic_downcast<WorkingMemHandle*>(&iWorkingMemHandle);
+
+    // Data that must be kept alive for the entire execution of the workload.
+    WorkloadData workloadData(inputTensors, outputTensors);
+
+    auto copyFunc = [](void* dst, const void* src, size_t size)
+    {
+        memcpy(dst, src, size);
+    };
+
+    bool success = true;
+
+    auto Fail = [&](const std::exception& error)
+    {
+        BOOST_LOG_TRIVIAL(error) << "An error occurred attempting to execute a workload: " << error.what();
+        success = false;
+    };
+
+    try
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(m_WorkingMemMutex);
+
+        for (const BindableLayer* inputLayer : graph.GetInputLayers())
+        {
+            const TensorPin& pin = workloadData.GetInputTensorPin(inputLayer->GetBindingId());
+            CopyTensorContentsGeneric(pin.GetTensorHandle(),
+                                      workingMemHandle.GetInputHandle(inputLayer->GetBindingId()),
+                                      copyFunc);
+        }
+
+        for (size_t i = 0; i < m_WorkloadQueue.size(); ++i)
+        {
+            m_WorkloadQueue[i]->ExecuteAsync(workingMemHandle.GetWorkingMemDescriptorAt(i));
+        }
+
+        for (const BindableLayer* outputLayer : graph.GetOutputLayers())
+        {
+            const TensorPin& pin = workloadData.GetOutputTensorPin(outputLayer->GetBindingId());
+            CopyTensorContentsGeneric(workingMemHandle.GetOutputHandle(outputLayer->GetBindingId()),
+                                      pin.GetTensorHandle(),
+                                      copyFunc);
+        }
+    }
+    catch (const RuntimeException& error)
+    {
+        Fail(error);
+    }
+    catch (const std::runtime_error& error)
+    {
+        Fail(error);
+    }
+
+    return success ? Status::Success : Status::Failure;
+}
+
 void LoadedNetwork::RegisterDebugCallback(const DebugCallbackFunction& func)
 {
     for (auto&& workloadPtr: m_WorkloadQueue)
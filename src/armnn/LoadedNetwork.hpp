@@ -4,6 +4,7 @@
 //
 #pragma once
 
+#include <armnn/IWorkingMemHandle.hpp>
 #include <armnn/Tensor.hpp>
 #include <armnn/Types.hpp>
 
@@ -17,6 +18,7 @@
 #include <backendsCommon/WorkloadFactory.hpp>
 
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 
 namespace cl
@@ -38,11 +40,27 @@ public:
     TensorInfo GetInputTensorInfo(LayerBindingId layerId) const;
     TensorInfo GetOutputTensorInfo(LayerBindingId layerId) const;
 
+    /// Runs the network on the working memory it owns. Concurrent calls are run one at a time.
     Status EnqueueWorkload(const InputTensors& inputTensors, const OutputTensors& outputTensors);
 
+    /// Creates a set of intermediate tensors, independent from the ones owned by this network, which Execute()
+    /// runs the workloads on. The constant tensors of the network are shared rather than copied. The memory of the
+    /// intermediate tensors is planned from their lifetimes by memory managers owned by the working memory.
+    std::unique_ptr<IWorkingMemHandle> CreateWorkingMemHandle(NetworkId networkId);
+
+    /// Runs the network on the working memory of workingMemHandle. Several calls can run at the same time
+    /// provided each of them uses a different working memory.
+    Status Execute(const InputTensors& inputTensors,
+                   const OutputTensors& outputTensors,
+                   IWorkingMemHandle& workingMemHandle);
+
+    using BackendContexts = std::unordered_map<BackendId, IBackendInternal::IBackendContextPtr>;
+
+    /// The backends of the network are given the contexts the runtime created for them, if any.
     static std::unique_ptr<LoadedNetwork> MakeLoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
                                                             std::string & errorMessage,
-                                                            const INetworkProperties& networkProperties);
+                                                            const INetworkProperties& networkProperties,
+                                                            const BackendContexts& backendContexts);
 
     // NOTE we return by reference as the purpose of this method is only to provide
     // access to the private m_Profiler and in theory we should not need to increment
@@ -51,12 +69,17 @@ public:
 
     void FreeWorkingMemory();
 
+    /// The memory planned by the memory managers of the network for its intermediate tensors.
+    WorkingMemoryStatistics GetWorkingMemoryStatistics() const;
+
     void RegisterDebugCallback(const DebugCallbackFunction& func);
 
 private:
     void AllocateWorkingMemory();
 
-    LoadedNetwork(std::unique_ptr<OptimizedNetwork> net, const INetworkProperties& networkProperties);
+    LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
+                  const INetworkProperties& networkProperties,
+                  const BackendContexts& backendContexts);
 
     void EnqueueInput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo);
 
@@ -80,9 +103,16 @@ private:
     WorkloadQueue m_InputQueue;
     WorkloadQueue m_WorkloadQueue;
     WorkloadQueue m_OutputQueue;
+    // The layer each workload of m_WorkloadQueue was created from.
+    std::vector<Layer*> m_WorkloadLayers;
     std::shared_ptr<Profiler> m_Profiler;
 
-    mutable std::mutex m_WorkingMemMutex;
+    // Held exclusively while the working memory owned by the network is in use, and shared by executions
+    // running on their own working memory.
+    mutable std::shared_timed_mutex m_WorkingMemMutex;
+
+    // Held by EnqueueWorkload(), which builds the input and output queues before executing them.
+    std::mutex m_EnqueueWorkloadMutex;
 
     bool m_IsWorkingMemAllocated=false;
     bool m_IsImportEnabled=false;
@@ -10,6 +10,7 @@
 #include "Optimizer.hpp"
 #include "SubgraphViewSelector.hpp"
 #include "BackendSettings.hpp"
+#include "OptimizedNetworkCache.hpp"
 #include "optimizations/All.hpp"
 
 #include <backendsCommon/CpuTensorHandle.hpp>
@@ -860,18 +861,35 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
     TensorHandleFactoryRegistry tensorHandleFactoryRegistry;
     BackendsMap backends = CreateSupportedBackends(tensorHandleFactoryRegistry, backendSettings);
 
-    // Assign an available backend to each layer
-    Graph::Iterator firstLayer = optGraph.begin();
-    Graph::Iterator lastLayer  = optGraph.end();
-    OptimizationResult assignBackendsResult = AssignBackends(optNetObjPtr,
-                                                             backendSettings,
-                                                             firstLayer,
-                                                             lastLayer,
-                                                             messages);
-    if (assignBackendsResult.m_Error)
+    // The backend assignment and the tensor handle strategies only depend on the graph, the backends and the
+    // options, so they can be restored from an earlier optimization of the same network.
+    std::unique_ptr<OptimizedNetworkCache> cache;
+    if (!options.m_CacheDirectory.empty() && !options.m_Debug)
     {
-        // Failed to assign a backend to each layer
-        return IOptimizedNetworkPtr(nullptr, &IOptimizedNetwork::Destroy);
+        cache = std::make_unique<OptimizedNetworkCache>(options.m_CacheDirectory, optGraph, backendSettings, options);
+    }
+
+    const bool backendsRestored = cache && cache->RestoreBackends(optGraph, backendSettings);
+    if (!backendsRestored)
+    {
+        // Assign an available backend to each layer
+        Graph::Iterator firstLayer = optGraph.begin();
+        Graph::Iterator lastLayer  = optGraph.end();
+        OptimizationResult assignBackendsResult = AssignBackends(optNetObjPtr,
+                                                                 backendSettings,
+                                                                 firstLayer,
+                                                                 lastLayer,
+                                                                 messages);
+        if (assignBackendsResult.m_Error)
+        {
+            // Failed to assign a backend to each layer
+            return IOptimizedNetworkPtr(nullptr, &IOptimizedNetwork::Destroy);
+        }
+
+        if (cache && !cache->RecordBackends(optGraph))
+        {
+            cache.reset();
+        }
     }
 
     Optimizer::Pass(optGraph, MakeOptimizations(OptimizeInverseConversionsFp16(),
@@ -895,15 +913,24 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
         Optimizer::Pass(optGraph, MakeOptimizations(InsertDebugLayer()));
     }
 
-    // Calculate the compatibility strategies for tensor handles
-    OptimizationResult strategyResult = SelectTensorHandleStrategy(optGraph,
-                                                                   backends,
-                                                                   tensorHandleFactoryRegistry,
-                                                                   messages);
-    if (strategyResult.m_Error)
+    if (!backendsRestored || !cache->RestoreTensorHandleStrategies(optGraph))
     {
-        // Failed to apply the backend-specific optimizations
-        return IOptimizedNetworkPtr(nullptr, &IOptimizedNetwork::Destroy);
+        // Calculate the compatibility strategies for tensor handles
+        OptimizationResult strategyResult = SelectTensorHandleStrategy(optGraph,
+                                                                       backends,
+                                                                       tensorHandleFactoryRegistry,
+                                                                       messages);
+        if (strategyResult.m_Error)
+        {
+            // Failed to apply the backend-specific optimizations
+            return IOptimizedNetworkPtr(nullptr, &IOptimizedNetwork::Destroy);
+        }
+
+        if (cache)
+        {
+            cache->RecordTensorHandleStrategies(optGraph);
+            cache->Store();
+        }
     }
 
     // Based on the tensor handle strategy determined above, insert copy layers where required.
@@ -978,11 +1005,11 @@ IConnectableLayer* Network::AddFullyConnectedLayerImpl(const FullyConnectedDescr
 
     const auto layer = m_Graph->AddLayer<FullyConnectedLayer>(fullyConnectedDescriptor, name);
 
-    layer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(weights);
+    layer->m_Weight = MakeConstantHandle(weights);
 
     if (fullyConnectedDescriptor.m_BiasEnabled)
     {
-        layer->m_Bias = std::make_unique<ScopedCpuTensorHandle>(biases.value());
+        layer->m_Bias = MakeConstantHandle(biases.value());
     }
 
     return layer;
@@ -1031,11 +1058,11 @@ IConnectableLayer* Network::AddConvolution2dLayerImpl(const Convolution2dDescrip
 
     const auto layer = m_Graph->AddLayer<Convolution2dLayer>(convolution2dDescriptor, name);
 
-    layer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(weights);
+    layer->m_Weight = MakeConstantHandle(weights);
 
     if (convolution2dDescriptor.m_BiasEnabled)
     {
-        layer->m_Bias = std::make_unique<ScopedCpuTensorHandle>(biases.value());
+        layer->m_Bias = MakeConstantHandle(biases.value());
     }
 
     return layer;
@@ -1079,11 +1106,11 @@ IConnectableLayer* Network::AddDepthwiseConvolution2dLayerImpl(
 
     const auto layer = m_Graph->AddLayer<DepthwiseConvolution2dLayer>(convolution2dDescriptor, name);
 
-    layer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(weights);
+    layer->m_Weight = MakeConstantHandle(weights);
 
     if (convolution2dDescriptor.m_BiasEnabled)
     {
-        layer->m_Bias = std::make_unique<ScopedCpuTensorHandle>(biases.value());
+        layer->m_Bias = MakeConstantHandle(biases.value());
     }
 
     return layer;
@@ -1128,7 +1155,7 @@ IConnectableLayer* Network::AddDetectionPostProcessLayer(const armnn::DetectionP
 {
     const auto layer = m_Graph->AddLayer<DetectionPostProcessLayer>(descriptor, name);
 
-    layer->m_Anchors = std::make_unique<ScopedCpuTensorHandle>(anchors);
+    layer->m_Anchors = MakeConstantHandle(anchors);
 
     return layer;
 }
@@ -1226,10 +1253,10 @@ IConnectableLayer* Network::AddBatchNormalizationLayer(const BatchNormalizationD
 {
     const auto layer = m_Graph->AddLayer<BatchNormalizationLayer>(desc, name);
 
-    layer->m_Mean = std::make_unique<ScopedCpuTensorHandle>(mean);
-    layer->m_Variance = std::make_unique<ScopedCpuTensorHandle>(variance);
-    layer->m_Beta = std::make_unique<ScopedCpuTensorHandle>(beta);
-    layer->m_Gamma = std::make_unique<ScopedCpuTensorHandle>(gamma);
+    layer->m_Mean = MakeConstantHandle(mean);
+    layer->m_Variance = MakeConstantHandle(variance);
+    layer->m_Beta = MakeConstantHandle(beta);
+    layer->m_Gamma = MakeConstantHandle(gamma);
 
     return layer;
 }
@@ -1270,11 +1297,31 @@ IConnectableLayer* Network::AddLogSoftmaxLayer(const LogSoftmaxDescriptor& desc,
     return m_Graph->AddLayer<LogSoftmaxLayer>(desc, name);
 }
 
+void Network::ShareConstantMemory(std::shared_ptr<void> sharedMemory, const void* data, size_t numBytes)
+{
+    const char* begin = static_cast<const char*>(data);
+    m_SharedConstantMemory.push_back({ std::move(sharedMemory), begin, begin + numBytes });
+}
+
+std::unique_ptr<ScopedCpuTensorHandle> Network::MakeConstantHandle(const ConstTensor& tensor) const
+{
+    const char* begin = static_cast<const char*>(tensor.GetMemoryArea());
+    const char* end   = begin + tensor.GetNumBytes();
+    for (const SharedConstantMemory& sharedMemory : m_SharedConstantMemory)
+    {
+        if (begin >= sharedMemory.m_Begin && end <= sharedMemory.m_End)
+        {
+            return std::make_unique<ScopedCpuTensorHandle>(tensor, sharedMemory.m_Memory);
+        }
+    }
+    return std::make_unique<ScopedCpuTensorHandle>(tensor);
+}
+
 IConnectableLayer* Network::AddConstantLayer(const ConstTensor& input, const char* name)
 {
     auto layer = m_Graph->AddLayer<ConstantLayer>(name);
 
-    layer->m_LayerOutput = std::make_unique<ScopedCpuTensorHandle>(input);
+    layer->m_LayerOutput = MakeConstantHandle(input);
 
     return layer;
 }
@@ -1310,23 +1357,23 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
 
     //Lstm Basic Parameters
     layer->m_BasicParameters.m_InputToForgetWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToForgetWeights));
+        MakeConstantHandle(*(params.m_InputToForgetWeights));
     layer->m_BasicParameters.m_InputToCellWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToCellWeights));
+        MakeConstantHandle(*(params.m_InputToCellWeights));
     layer->m_BasicParameters.m_InputToOutputWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToOutputWeights));
+        MakeConstantHandle(*(params.m_InputToOutputWeights));
     layer->m_BasicParameters.m_RecurrentToForgetWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToForgetWeights));
+        MakeConstantHandle(*(params.m_RecurrentToForgetWeights));
     layer->m_BasicParameters.m_RecurrentToCellWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToCellWeights));
+        MakeConstantHandle(*(params.m_RecurrentToCellWeights));
     layer->m_BasicParameters.m_RecurrentToOutputWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToOutputWeights));
+        MakeConstantHandle(*(params.m_RecurrentToOutputWeights));
     layer->m_BasicParameters.m_ForgetGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_ForgetGateBias));
+            MakeConstantHandle(*(params.m_ForgetGateBias));
     layer->m_BasicParameters.m_CellBias =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellBias));
+            MakeConstantHandle(*(params.m_CellBias));
     layer->m_BasicParameters.m_OutputGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_OutputGateBias));
+            MakeConstantHandle(*(params.m_OutputGateBias));
 
     //Lstm Cifg parameters
     if(!descriptor.m_CifgEnabled)
@@ -1345,17 +1392,17 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
             throw InvalidArgumentException("AddLstmLayer: Input Gate Bias cannot be NULL");
         }
         layer->m_CifgParameters.m_InputToInputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToInputWeights));
+            MakeConstantHandle(*(params.m_InputToInputWeights));
         layer->m_CifgParameters.m_RecurrentToInputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToInputWeights));
+            MakeConstantHandle(*(params.m_RecurrentToInputWeights));
         // In the VTS tests, cell-to-input weights may be null, even if the other CIFG params are not.
         if(params.m_CellToInputWeights != nullptr)
         {
             layer->m_CifgParameters.m_CellToInputWeights =
-                    std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellToInputWeights));
+                    MakeConstantHandle(*(params.m_CellToInputWeights));
         }
         layer->m_CifgParameters.m_InputGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputGateBias));
+            MakeConstantHandle(*(params.m_InputGateBias));
     }
 
     //Lstm projection parameters
@@ -1366,11 +1413,11 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
             throw InvalidArgumentException("AddLstmLayer: Projection Weights cannot be NULL");
         }
         layer->m_ProjectionParameters.m_ProjectionWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_ProjectionWeights));
+            MakeConstantHandle(*(params.m_ProjectionWeights));
         if(params.m_ProjectionBias != nullptr)
         {
             layer->m_ProjectionParameters.m_ProjectionBias =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_ProjectionBias));
+                MakeConstantHandle(*(params.m_ProjectionBias));
         }
     }
 
@@ -1386,9 +1433,9 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
             throw InvalidArgumentException("AddLstmLayer: Cell To Output Weights cannot be NULL");
         }
         layer->m_PeepholeParameters.m_CellToForgetWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellToForgetWeights));
+            MakeConstantHandle(*(params.m_CellToForgetWeights));
         layer->m_PeepholeParameters.m_CellToOutputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellToOutputWeights));
+            MakeConstantHandle(*(params.m_CellToOutputWeights));
     }
 
     //Lstm Layer Normalization params
@@ -1401,7 +1448,7 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
                 throw InvalidArgumentException("AddLstmLayer: Input layer normalization weights cannot be NULL");
             }
             layer->m_LayerNormParameters.m_InputLayerNormWeights =
-                    std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputLayerNormWeights));
+                    MakeConstantHandle(*(params.m_InputLayerNormWeights));
         }
 
         if(params.m_ForgetLayerNormWeights == nullptr)
@@ -1417,11 +1464,11 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
             throw InvalidArgumentException("AddLstmLayer: Output layer normalization weights cannot be NULL");
         }
         layer->m_LayerNormParameters.m_ForgetLayerNormWeights =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_ForgetLayerNormWeights));
+                MakeConstantHandle(*(params.m_ForgetLayerNormWeights));
         layer->m_LayerNormParameters.m_CellLayerNormWeights =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellLayerNormWeights));
+                MakeConstantHandle(*(params.m_CellLayerNormWeights));
         layer->m_LayerNormParameters.m_OutputLayerNormWeights =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_OutputLayerNormWeights));
+                MakeConstantHandle(*(params.m_OutputLayerNormWeights));
     }
     return layer;
 }
@@ -1509,11 +1556,11 @@ IConnectableLayer* Network::AddTransposeConvolution2dLayer(const TransposeConvol
 
     const auto layer = m_Graph->AddLayer<TransposeConvolution2dLayer>(descriptor, name);
 
-    layer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(weights);
+    layer->m_Weight = MakeConstantHandle(weights);
 
     if (descriptor.m_BiasEnabled)
     {
-        layer->m_Bias = std::make_unique<ScopedCpuTensorHandle>(biases.value());
+        layer->m_Bias = MakeConstantHandle(biases.value());
     }
 
     return layer;
@@ -1539,33 +1586,33 @@ IConnectableLayer* Network::AddQuantizedLstmLayer(const QuantizedLstmInputParams
 
     // InputToX weights
     layer->m_QuantizedLstmParameters.m_InputToInputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetInputToInputWeights());
+            MakeConstantHandle(params.GetInputToInputWeights());
     layer->m_QuantizedLstmParameters.m_InputToForgetWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetInputToForgetWeights());
+            MakeConstantHandle(params.GetInputToForgetWeights());
     layer->m_QuantizedLstmParameters.m_InputToCellWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetInputToCellWeights());
+            MakeConstantHandle(params.GetInputToCellWeights());
     layer->m_QuantizedLstmParameters.m_InputToOutputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetInputToOutputWeights());
+            MakeConstantHandle(params.GetInputToOutputWeights());
 
     // RecurrentToX weights
     layer->m_QuantizedLstmParameters.m_RecurrentToInputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetRecurrentToInputWeights());
+            MakeConstantHandle(params.GetRecurrentToInputWeights());
     layer->m_QuantizedLstmParameters.m_RecurrentToForgetWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetRecurrentToForgetWeights());
+            MakeConstantHandle(params.GetRecurrentToForgetWeights());
     layer->m_QuantizedLstmParameters.m_RecurrentToCellWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetRecurrentToCellWeights());
+            MakeConstantHandle(params.GetRecurrentToCellWeights());
     layer->m_QuantizedLstmParameters.m_RecurrentToOutputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetRecurrentToOutputWeights());
+            MakeConstantHandle(params.GetRecurrentToOutputWeights());
 
     // Bias
     layer->m_QuantizedLstmParameters.m_InputGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetInputGateBias());
+            MakeConstantHandle(params.GetInputGateBias());
     layer->m_QuantizedLstmParameters.m_ForgetGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetForgetGateBias());
+            MakeConstantHandle(params.GetForgetGateBias());
     layer->m_QuantizedLstmParameters.m_CellBias =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetCellBias());
+            MakeConstantHandle(params.GetCellBias());
     layer->m_QuantizedLstmParameters.m_OutputGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetOutputGateBias());
+            MakeConstantHandle(params.GetOutputGateBias());
 
     return layer;
 }
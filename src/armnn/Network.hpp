@@ -12,6 +12,8 @@
 
 #include <armnn/INetwork.hpp>
 
+#include <backendsCommon/CpuTensorHandleFwd.hpp>
+
 #include <string>
 #include <vector>
 #include <map>
@@ -232,7 +234,13 @@ public:
 
     void Accept(ILayerVisitor& visitor) const override;
 
+    void ShareConstantMemory(std::shared_ptr<void> sharedMemory, const void* data, size_t numBytes) override;
+
 private:
+    // Returns a handle to a constant tensor of a layer, which refers to the tensor's data if it lies in memory
+    // shared with ShareConstantMemory() and holds a copy of it otherwise.
+    std::unique_ptr<ScopedCpuTensorHandle> MakeConstantHandle(const ConstTensor& tensor) const;
+
     IConnectableLayer* AddFullyConnectedLayerImpl(const FullyConnectedDescriptor& fullyConnectedDescriptor,
                                                   const ConstTensor& weights,
                                                   const Optional<ConstTensor>& biases,
@@ -249,8 +257,16 @@ private:
         const Optional<ConstTensor>& biases,
         const char* name);
 
+    struct SharedConstantMemory
+    {
+        std::shared_ptr<void> m_Memory;
+        const char* m_Begin;
+        const char* m_End;
+    };
+
     std::unique_ptr<Graph> m_Graph;
     profiling::ProfilingGuid m_Guid;
+    std::vector<SharedConstantMemory> m_SharedConstantMemory;
 };
 
 class OptimizedNetwork final : public IOptimizedNetwork
@@ -0,0 +1,609 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "OptimizedNetworkCache.hpp"
+
+#include "Layer.hpp"
+#include "NetworkUtils.hpp"
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <armnn/TypesUtils.hpp>
+#include <armnn/Version.hpp>
+
+#include <boost/log/trivial.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace armnn
+{
+
+namespace
+{
+
+const char* const MagicString = "ArmNN optimized network cache";
+
+const uint64_t FnvOffsetBasis = 14695981039346656037ull;
+
+// 64 bit FNV-1a. Unlike std::hash, its value doesn't depend on the platform or the standard library, so the keys are
+// the same in every process.
+uint64_t Hash(const void* data, size_t numBytes, uint64_t hash = FnvOffsetBasis)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < numBytes; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+uint64_t Hash(const std::string& data)
+{
+    return Hash(data.data(), data.size());
+}
+
+std::string ToHexString(uint64_t value)
+{
+    std::stringstream stream;
+    stream << std::hex << std::setw(16) << std::setfill('0') << value;
+    return stream.str();
+}
+
+void DescribeTensorInfo(std::ostream& description, const TensorInfo& info)
+{
+    description << " [";
+    for (unsigned int i = 0; i < info.GetNumDimensions(); ++i)
+    {
+        description << " " << info.GetShape()[i];
+    }
+    description << " ] " << GetDataTypeName(info.GetDataType()) << " " << info.GetQuantizationOffset();
+
+    // Hexadecimal floats are exact.
+    description << std::hexfloat;
+    for (float scale : info.GetQuantizationScales())
+    {
+        description << " " << scale;
+    }
+    description << std::defaultfloat;
+
+    if (info.GetQuantizationDim().has_value())
+    {
+        description << " dim " << info.GetQuantizationDim().value();
+    }
+}
+
+std::string DescribeGraph(const Graph& graph)
+{
+    std::stringstream description;
+    std::unordered_map<const Layer*, unsigned int> layerIndices;
+
+    for (const Layer* layer : graph.TopologicalSort())
+    {
+        const unsigned int layerIndex = static_cast<unsigned int>(layerIndices.size());
+        layerIndices[layer] = layerIndex;
+
+        description << layerIndex << " " << GetLayerTypeAsCString(layer->GetType())
+                    << " " << std::quoted(layer->GetNameStr());
+
+        ParameterStringifyFunction describeParameter = [&description](const std::string& name,
+                                                                      const std::string& value)
+        {
+            description << " " << name << "=" << value;
+        };
+        layer->SerializeLayerParameters(describeParameter);
+
+        // Networks which only differ by the values of their weights get different entries. The constants are only
+        // read, OperateOnConstantTensors() is non-const because it also allows replacing them.
+        const_cast<Layer*>(layer)->OperateOnConstantTensors(
+            [&description](const std::unique_ptr<ScopedCpuTensorHandle>& constant)
+            {
+                const void* data = constant->GetConstTensor<void>();
+                if (data != nullptr)
+                {
+                    description << " const " << ToHexString(Hash(data, constant->GetTensorInfo().GetNumBytes()));
+                }
+            });
+
+        for (const InputSlot& inputSlot : layer->GetInputSlots())
+        {
+            const OutputSlot* connection = inputSlot.GetConnectedOutputSlot();
+            if (connection)
+            {
+                description << " <- " << layerIndices.at(&connection->GetOwningLayer())
+                            << ":" << connection->CalculateIndexOnOwner();
+            }
+            else
+            {
+                description << " <- none";
+            }
+        }
+
+        for (const OutputSlot& outputSlot : layer->GetOutputSlots())
+        {
+            description << " ->";
+            DescribeTensorInfo(description, outputSlot.GetTensorInfo());
+        }
+
+        description << "\n";
+    }
+
+    return description.str();
+}
+
+std::string DescribeOptimization(const BackendSettings& backendSettings, const OptimizerOptions& options)
+{
+    std::stringstream description;
+    description << MagicString << " " << OptimizedNetworkCache::Version << " " << ARMNN_VERSION << "\n";
+
+    description << "preferred";
+    for (const BackendId& backend : backendSettings.m_PreferredBackends)
+    {
+        description << " " << backend;
+    }
+
+    // The supported backends are held in an unordered set.
+    std::vector<std::string> supportedBackends;
+    for (const BackendId& backend : backendSettings.m_SupportedBackends)
+    {
+        supportedBackends.push_back(backend.Get());
+    }
+    std::sort(supportedBackends.begin(), supportedBackends.end());
+
+    description << "\nsupported";
+    for (const std::string& backend : supportedBackends)
+    {
+        description << " " << backend;
+    }
+
+    description << "\nreduceFp32ToFp16 " << options.m_ReduceFp32ToFp16 << " debug " << options.m_Debug << "\n";
+
+    return description.str();
+}
+
+bool IsValidEdgeStrategy(int strategy)
+{
+    return strategy == static_cast<int>(EdgeStrategy::DirectCompatibility) ||
+           strategy == static_cast<int>(EdgeStrategy::ExportToTarget) ||
+           strategy == static_cast<int>(EdgeStrategy::CopyToTarget);
+}
+
+using LayerBackend = OptimizedNetworkCache::LayerBackend;
+using LayerDecisions = OptimizedNetworkCache::LayerDecisions;
+using OutputSlotDecisions = OptimizedNetworkCache::OutputSlotDecisions;
+
+bool HasConverters(const LayerBackend& layerBackend)
+{
+    return !layerBackend.m_ConvertersBefore.empty() || !layerBackend.m_ConvertersAfter.empty();
+}
+
+// The number of ConvertFp16ToFp32 layers InsertConvertFp16ToFp32LayersBefore() inserts before the layer, when the
+// backend assignment falls back to Float32 for it.
+size_t GetNumConvertersBefore(const Layer& layer)
+{
+    if (layer.GetNumInputSlots() == 0 ||
+        layer.GetInputSlot(0).GetConnectedOutputSlot()->GetTensorInfo().GetDataType() != DataType::Float16)
+    {
+        return 0;
+    }
+
+    return static_cast<size_t>(std::count_if(layer.GetInputSlots().begin(), layer.GetInputSlots().end(),
+        [](const InputSlot& inputSlot)
+        {
+            const OutputSlot* connection = inputSlot.GetConnectedOutputSlot();
+            return connection && connection->GetTensorInfo().GetDataType() == DataType::Float16;
+        }));
+}
+
+// The number of ConvertFp32ToFp16 layers InsertConvertFp32ToFp16LayersAfter() inserts after the layer.
+size_t GetNumConvertersAfter(const Layer& layer)
+{
+    if (layer.GetNumOutputSlots() == 0 ||
+        layer.GetOutputSlot(0).GetTensorInfo().GetDataType() != DataType::Float16)
+    {
+        return 0;
+    }
+
+    return static_cast<size_t>(std::count_if(layer.GetOutputSlots().begin(), layer.GetOutputSlots().end(),
+        [](const OutputSlot& outputSlot)
+        {
+            const DataType dataType = outputSlot.GetTensorInfo().GetDataType();
+            return dataType == DataType::Float16 || dataType == DataType::Float32;
+        }));
+}
+
+// Reads the decisions stored in a cache file. Returns false if the file is malformed or holds the decisions for
+// another key.
+bool ReadDecisions(std::istream& file,
+                   uint64_t key,
+                   std::vector<LayerBackend>& backends,
+                   std::vector<LayerDecisions>& strategies)
+{
+    std::string magicString;
+    unsigned int version = 0;
+    std::string keyString;
+    std::string section;
+    size_t numLayers = 0;
+    if (!std::getline(file, magicString) || magicString != MagicString ||
+        !(file >> version) || version != OptimizedNetworkCache::Version ||
+        !(file >> keyString) || keyString != ToHexString(key) ||
+        !(file >> section >> numLayers) || section != "backends")
+    {
+        return false;
+    }
+
+    auto readBackendId = [&file](BackendId& backendId)
+    {
+        std::string id;
+        if (!(file >> std::quoted(id)))
+        {
+            return false;
+        }
+        backendId = id;
+        return true;
+    };
+
+    auto readConverterBackendIds = [&](std::vector<BackendId>& backendIds)
+    {
+        size_t numConverters = 0;
+        if (!(file >> numConverters))
+        {
+            return false;
+        }
+        backendIds.resize(numConverters);
+        return std::all_of(backendIds.begin(), backendIds.end(), readBackendId);
+    };
+
+    backends.resize(numLayers);
+    for (LayerBackend& layerBackend : backends)
+    {
+        if (!(file >> layerBackend.m_LayerType) ||
+            !readBackendId(layerBackend.m_BackendId) ||
+            !readConverterBackendIds(layerBackend.m_ConvertersBefore) ||
+            !readConverterBackendIds(layerBackend.m_ConvertersAfter))
+        {
+            return false;
+        }
+    }
+
+    if (!(file >> section >> numLayers) || section != "strategies")
+    {
+        return false;
+    }
+
+    strategies.resize(numLayers);
+    for (LayerDecisions& layerDecisions : strategies)
+    {
+        unsigned int numOutputSlots = 0;
+        if (!(file >> layerDecisions.m_LayerType >> numOutputSlots))
+        {
+            return false;
+        }
+
+        layerDecisions.m_OutputSlots.resize(numOutputSlots);
+        for (OutputSlotDecisions& slotDecisions : layerDecisions.m_OutputSlots)
+        {
+            unsigned int numConnections = 0;
+            if (!(file >> std::quoted(slotDecisions.m_FactoryId) >> numConnections))
+            {
+                return false;
+            }
+
+            for (unsigned int i = 0; i < numConnections; ++i)
+            {
+                int strategy = 0;
+                if (!(file >> strategy) || !IsValidEdgeStrategy(strategy))
+                {
+                    return false;
+                }
+                slotDecisions.m_EdgeStrategies.push_back(static_cast<EdgeStrategy>(strategy));
+            }
+        }
+    }
+
+    return true;
+}
+
+} // anonymous namespace
+
+OptimizedNetworkCache::OptimizedNetworkCache(const std::string& directory,
+                                             const Graph& graph,
+                                             const BackendSettings& backendSettings,
+                                             const OptimizerOptions& options)
+    : m_Key(Hash(DescribeOptimization(backendSettings, options) + DescribeGraph(graph)))
+    , m_FilePath(directory + "/" + ToHexString(m_Key) + ".armnncache")
+{
+    for (const Layer* layer : graph.TopologicalSort())
+    {
+        m_LayerGuids.push_back(layer->GetGuid());
+    }
+
+    std::ifstream file(m_FilePath);
+    if (file && !ReadDecisions(file, m_Key, m_Backends, m_Strategies))
+    {
+        BOOST_LOG_TRIVIAL(warning) << "Ignoring the malformed optimized network cache file " << m_FilePath;
+        m_Backends.clear();
+        m_Strategies.clear();
+    }
+}
+
+bool OptimizedNetworkCache::RestoreBackends(Graph& graph, BackendSettings& backendSettings) const
+{
+    if (m_Backends.size() != graph.GetNumLayers())
+    {
+        return false;
+    }
+
+    auto isSupported = [&backendSettings](const BackendId& backendId)
+    {
+        return backendSettings.IsBackendSupported(backendId);
+    };
+
+    // Checks everything before changing the graph, which has to be left unchanged if the decisions don't apply.
+    std::vector<Layer*> layers;
+    auto layerBackend = m_Backends.begin();
+    for (Layer* layer : graph.TopologicalSort())
+    {
+        if (layerBackend->m_LayerType != GetLayerTypeAsCString(layer->GetType()) ||
+            !isSupported(layerBackend->m_BackendId) ||
+            !std::all_of(layerBackend->m_ConvertersBefore.begin(), layerBackend->m_ConvertersBefore.end(),
+                         isSupported) ||
+            !std::all_of(layerBackend->m_ConvertersAfter.begin(), layerBackend->m_ConvertersAfter.end(),
+                         isSupported))
+        {
+            return false;
+        }
+
+        if (HasConverters(*layerBackend) &&
+            (layerBackend->m_ConvertersBefore.size() != GetNumConvertersBefore(*layer) ||
+             layerBackend->m_ConvertersAfter.size() != GetNumConvertersAfter(*layer)))
+        {
+            return false;
+        }
+
+        layers.push_back(layer);
+        ++layerBackend;
+    }
+
+    layerBackend = m_Backends.begin();
+    for (Layer* layer : layers)
+    {
+        layer->SetBackendId(layerBackend->m_BackendId);
+        backendSettings.m_SelectedBackends.insert(layerBackend->m_BackendId);
+
+        // Inserts the conversion layers the backend assignment inserted around the layers which are only supported
+        // in Float32, in the same way.
+        if (HasConverters(*layerBackend))
+        {
+            std::vector<ConvertFp16ToFp32Layer*> convertersBefore;
+            if (!layerBackend->m_ConvertersBefore.empty())
+            {
+                convertersBefore = InsertConvertFp16ToFp32LayersBefore(graph, *layer);
+            }
+
+            std::vector<ConvertFp32ToFp16Layer*> convertersAfter;
+            if (!layerBackend->m_ConvertersAfter.empty())
+            {
+                convertersAfter = InsertConvertFp32ToFp16LayersAfter(graph, *layer);
+            }
+
+            BOOST_ASSERT(convertersBefore.size() == layerBackend->m_ConvertersBefore.size());
+            BOOST_ASSERT(convertersAfter.size() == layerBackend->m_ConvertersAfter.size());
+            for (size_t i = 0; i < convertersBefore.size(); ++i)
+            {
+                convertersBefore[i]->SetBackendId(layerBackend->m_ConvertersBefore[i]);
+                backendSettings.m_SelectedBackends.insert(layerBackend->m_ConvertersBefore[i]);
+            }
+            for (size_t i = 0; i < convertersAfter.size(); ++i)
+            {
+                convertersAfter[i]->SetBackendId(layerBackend->m_ConvertersAfter[i]);
+                backendSettings.m_SelectedBackends.insert(layerBackend->m_ConvertersAfter[i]);
+            }
+        }
+
+        ++layerBackend;
+    }
+
+    BOOST_LOG_TRIVIAL(debug) << "Restored the backends of the network from " << m_FilePath;
+    return true;
+}
+
+bool OptimizedNetworkCache::RestoreTensorHandleStrategies(Graph& graph) const
+{
+    if (m_Strategies.size() != graph.GetNumLayers())
+    {
+        return false;
+    }
+
+    auto layerDecisions = m_Strategies.begin();
+    for (const Layer* layer : graph.TopologicalSort())
+    {
+        if (layerDecisions->m_LayerType != GetLayerTypeAsCString(layer->GetType()) ||
+            layerDecisions->m_OutputSlots.size() != layer->GetNumOutputSlots())
+        {
+            return false;
+        }
+
+        for (unsigned int slotIdx = 0; slotIdx < layer->GetNumOutputSlots(); ++slotIdx)
+        {
+            if (layerDecisions->m_OutputSlots[slotIdx].m_EdgeStrategies.size() !=
+                layer->GetOutputSlot(slotIdx).GetNumConnections())
+            {
+                return false;
+            }
+        }
+        ++layerDecisions;
+    }
+
+    layerDecisions = m_Strategies.begin();
+    for (Layer* layer : graph.TopologicalSort())
+    {
+        for (unsigned int slotIdx = 0; slotIdx < layer->GetNumOutputSlots(); ++slotIdx)
+        {
+            const OutputSlotDecisions& slotDecisions = layerDecisions->m_OutputSlots[slotIdx];
+            OutputSlot& outputSlot = layer->GetOutputSlot(slotIdx);
+
+            outputSlot.SetTensorHandleFactory(slotDecisions.m_FactoryId);
+            for (unsigned int connectionIdx = 0; connectionIdx < slotDecisions.m_EdgeStrategies.size(); ++connectionIdx)
+            {
+                outputSlot.SetEdgeStrategy(connectionIdx, slotDecisions.m_EdgeStrategies[connectionIdx]);
+            }
+        }
+        ++layerDecisions;
+    }
+
+    BOOST_LOG_TRIVIAL(debug) << "Restored the tensor handle strategies of the network from " << m_FilePath;
+    return true;
+}
+
+bool OptimizedNetworkCache::RecordBackends(const Graph& graph)
+{
+    std::unordered_map<LayerGuid, const Layer*> layers;
+    for (const Layer* layer : graph)
+    {
+        layers[layer->GetGuid()] = layer;
+    }
+
+    // The layers which weren't in the graph the key was computed from are conversion layers inserted by the backend
+    // assignment.
+    const std::unordered_set<LayerGuid> originalLayers(m_LayerGuids.begin(), m_LayerGuids.end());
+    auto isConverter = [&originalLayers](const Layer& layer, LayerType converterType)
+    {
+        return layer.GetType() == converterType && originalLayers.count(layer.GetGuid()) == 0;
+    };
+
+    m_Backends.clear();
+    for (LayerGuid guid : m_LayerGuids)
+    {
+        auto layerIt = layers.find(guid);
+        if (layerIt == layers.end())
+        {
+            BOOST_LOG_TRIVIAL(warning) << "The backend assignment removed layers, the optimization of the network "
+                                       << "can't be stored in " << m_FilePath;
+            m_Backends.clear();
+            return false;
+        }
+        const Layer& layer = *layerIt->second;
+
+        LayerBackend layerBackend;
+        layerBackend.m_LayerType = GetLayerTypeAsCString(layer.GetType());
+        layerBackend.m_BackendId = layer.GetBackendId();
+
+        for (const InputSlot& inputSlot : layer.GetInputSlots())
+        {
+            const OutputSlot* connection = inputSlot.GetConnectedOutputSlot();
+            if (connection && isConverter(connection->GetOwningLayer(), LayerType::ConvertFp16ToFp32))
+            {
+                layerBackend.m_ConvertersBefore.push_back(connection->GetOwningLayer().GetBackendId());
+            }
+        }
+
+        for (const OutputSlot& outputSlot : layer.GetOutputSlots())
+        {
+            for (const InputSlot* connection : outputSlot.GetConnections())
+            {
+                if (isConverter(connection->GetOwningLayer(), LayerType::ConvertFp32ToFp16))
+                {
+                    layerBackend.m_ConvertersAfter.push_back(connection->GetOwningLayer().GetBackendId());
+                }
+            }
+        }
+
+        m_Backends.push_back(std::move(layerBackend));
+    }
+
+    return true;
+}
+
+void OptimizedNetworkCache::RecordTensorHandleStrategies(const Graph& graph)
+{
+    m_Strategies.clear();
+    for (const Layer* layer : graph.TopologicalSort())
+    {
+        LayerDecisions layerDecisions;
+        layerDecisions.m_LayerType = GetLayerTypeAsCString(layer->GetType());
+        for (const OutputSlot& outputSlot : layer->GetOutputSlots())
+        {
+            layerDecisions.m_OutputSlots.push_back({ outputSlot.GetTensorHandleFactoryId(),
+                                                     outputSlot.GetEdgeStrategies() });
+        }
+        m_Strategies.push_back(std::move(layerDecisions));
+    }
+}
+
+void OptimizedNetworkCache::Store() const
+{
+    std::stringstream contents;
+    contents << MagicString << "\n" << Version << "\n" << ToHexString(m_Key) << "\n";
+
+    contents << "backends " << m_Backends.size() << "\n";
+    auto writeConverterBackendIds = [&contents](const std::vector<BackendId>& backendIds)
+    {
+        contents << " " << backendIds.size();
+        for (const BackendId& backendId : backendIds)
+        {
+            contents << " " << std::quoted(backendId.Get());
+        }
+    };
+
+    for (const LayerBackend& layerBackend : m_Backends)
+    {
+        contents << layerBackend.m_LayerType << " " << std::quoted(layerBackend.m_BackendId.Get());
+        writeConverterBackendIds(layerBackend.m_ConvertersBefore);
+        writeConverterBackendIds(layerBackend.m_ConvertersAfter);
+        contents << "\n";
+    }
+
+    contents << "strategies " << m_Strategies.size() << "\n";
+    for (const LayerDecisions& layerDecisions : m_Strategies)
+    {
+        contents << layerDecisions.m_LayerType << " " << layerDecisions.m_OutputSlots.size();
+        for (const OutputSlotDecisions& slotDecisions : layerDecisions.m_OutputSlots)
+        {
+            contents << " " << std::quoted(slotDecisions.m_FactoryId) << " " << slotDecisions.m_EdgeStrategies.size();
+            for (EdgeStrategy strategy : slotDecisions.m_EdgeStrategies)
+            {
+                contents << " " << static_cast<int>(strategy);
+            }
+        }
+        contents << "\n";
+    }
+
+    // Several processes may optimize the same network at the same time: each writes its own temporary file and
+    // renames it, which replaces the file atomically, so that no process reads a partially written file.
+    std::stringstream temporaryFilePath;
+    temporaryFilePath << m_FilePath << ".tmp" << std::hash<std::thread::id>()(std::this_thread::get_id())
+                      << "." << std::chrono::steady_clock::now().time_since_epoch().count();
+
+    {
+        std::ofstream file(temporaryFilePath.str());
+        file << contents.str();
+        if (!file.flush())
+        {
+            BOOST_LOG_TRIVIAL(warning) << "Failed to write the optimized network cache file "
+                                       << temporaryFilePath.str();
+            std::remove(temporaryFilePath.str().c_str());
+            return;
+        }
+    }
+
+    if (std::rename(temporaryFilePath.str().c_str(), m_FilePath.c_str()) != 0)
+    {
+        BOOST_LOG_TRIVIAL(warning) << "Failed to write the optimized network cache file " << m_FilePath;
+        std::remove(temporaryFilePath.str().c_str());
+    }
+}
+
+} // namespace armnn
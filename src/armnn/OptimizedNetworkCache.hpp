@@ -0,0 +1,111 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "BackendSettings.hpp"
+#include "Graph.hpp"
+
+#include <armnn/INetwork.hpp>
+
+#include <backendsCommon/ITensorHandleFactory.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace armnn
+{
+
+/// Stores the decisions Optimize() takes for a network on disk, so that a later optimization of the same network,
+/// for the same backends and with the same options, possibly in another process, can reuse them instead of taking
+/// them again.
+///
+/// The decisions are the backend assigned to each layer, including the conversion layers inserted around the layers
+/// which are only supported in Float32, the tensor handle factory of each output slot and the strategy of each of its
+/// connections. They are taken by querying the backends for every layer and make up most of the time spent optimizing
+/// a large network. The passes which rewrite the graph, including the backend optimizations, are deterministic and
+/// run on every optimization.
+///
+/// Each network is stored in its own file, named after a key computed from the layers of the graph (their types,
+/// names, parameters, connections, tensor infos and the contents of their constant tensors), the preferred and
+/// supported backends, the optimizer options and the Arm NN version.
+class OptimizedNetworkCache
+{
+public:
+    /// Computes the key of the graph, as it is before backends are assigned to it, and reads the decisions stored for
+    /// it, if any.
+    OptimizedNetworkCache(const std::string& directory,
+                          const Graph& graph,
+                          const BackendSettings& backendSettings,
+                          const OptimizerOptions& options);
+
+    /// Assigns the stored backends to the layers of the graph, inserts the stored conversion layers, and adds the
+    /// backends to the selected backends. Returns false, leaving the graph unchanged, if no valid decisions are stored
+    /// for the graph.
+    bool RestoreBackends(Graph& graph, BackendSettings& backendSettings) const;
+
+    /// Assigns the stored tensor handle factories and edge strategies to the output slots of the graph, once the
+    /// backend optimizations have been applied. Returns false, leaving the graph unchanged, if no valid decisions are
+    /// stored for the graph.
+    bool RestoreTensorHandleStrategies(Graph& graph) const;
+
+    /// Records the backends assigned to the layers of the graph the key was computed from, and to the conversion layers
+    /// the backend assignment inserted into it. Returns false, logging a warning, if the backend assignment changed the
+    /// graph in a way which can't be restored.
+    bool RecordBackends(const Graph& graph);
+
+    /// Records the tensor handle factories and edge strategies selected for the graph.
+    void RecordTensorHandleStrategies(const Graph& graph);
+
+    /// Writes the recorded decisions to the cache file. Failing to write the file is not an error: a warning is
+    /// logged and the network is optimized again the next time.
+    void Store() const;
+
+    uint64_t GetKey() const { return m_Key; }
+
+    /// The file the decisions for the graph are stored in.
+    const std::string& GetFilePath() const { return m_FilePath; }
+
+    /// Incremented whenever the format of the files changes, which invalidates the existing ones.
+    static constexpr unsigned int Version = 1;
+
+    struct LayerBackend
+    {
+        std::string m_LayerType;
+        BackendId m_BackendId;
+
+        /// The backends of the conversion layers inserted before and after the layer when its backend only supports
+        /// it in Float32.
+        std::vector<BackendId> m_ConvertersBefore;
+        std::vector<BackendId> m_ConvertersAfter;
+    };
+
+    struct OutputSlotDecisions
+    {
+        ITensorHandleFactory::FactoryId m_FactoryId;
+        std::vector<EdgeStrategy> m_EdgeStrategies;
+    };
+
+    struct LayerDecisions
+    {
+        std::string m_LayerType;
+        std::vector<OutputSlotDecisions> m_OutputSlots;
+    };
+
+private:
+    uint64_t m_Key;
+    std::string m_FilePath;
+
+    // The layers of the graph the key was computed from, in topological order.
+    std::vector<LayerGuid> m_LayerGuids;
+
+    // The backend of each layer of the graph, in topological order.
+    std::vector<LayerBackend> m_Backends;
+
+    // The strategies of each layer of the graph, in topological order, after the backend optimizations.
+    std::vector<LayerDecisions> m_Strategies;
+};
+
+} // namespace armnn
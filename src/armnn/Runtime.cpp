@@ -13,6 +13,7 @@
 #include <ProfilingService.hpp>
 
 #include <iostream>
+#include <thread>
 
 #include <boost/log/trivial.hpp>
 #include <boost/polymorphic_cast.hpp>
@@ -74,7 +75,8 @@ Status Runtime::LoadNetwork(NetworkId& networkIdOut,
     unique_ptr<LoadedNetwork> loadedNetwork = LoadedNetwork::MakeLoadedNetwork(
         std::unique_ptr<OptimizedNetwork>(boost::polymorphic_downcast<OptimizedNetwork*>(rawNetwork)),
         errorMessage,
-        networkProperties);
+        networkProperties,
+        m_BackendContexts);
 
     if (!loadedNetwork)
     {
@@ -111,6 +113,14 @@ Status Runtime::UnloadNetwork(NetworkId networkId)
         return Status::Failure;
     }
 
+    {
+        std::lock_guard<std::mutex> lockGuard(m_ThreadpoolMutex);
+        if (m_Threadpool)
+        {
+            m_Threadpool->UnloadNetwork(networkId);
+        }
+    }
+
     {
         std::lock_guard<std::mutex> lockGuard(m_Mutex);
 
@@ -145,6 +155,8 @@ const std::shared_ptr<IProfiler> Runtime::GetProfiler(NetworkId networkId) const
 Runtime::Runtime(const CreationOptions& options)
     : m_NetworkIdCounter(0)
     , m_DeviceSpec{BackendRegistryInstance().GetBackendIds()}
+    , m_AsyncExecutionThreads(options.m_AsyncExecutionThreads)
+    , m_AsyncQueueCapacity(options.m_AsyncQueueCapacity)
 {
     BOOST_LOG_TRIVIAL(info) << "ArmNN v" << ARMNN_VERSION << "\n";
 
@@ -179,6 +191,9 @@ Runtime::Runtime(const CreationOptions& options)
 
 Runtime::~Runtime()
 {
+    // Runs the requests still queued and stops the worker threads before the networks go away.
+    m_Threadpool.reset();
+
     std::vector<int> networkIDs;
     try
     {
@@ -233,6 +248,11 @@ TensorInfo Runtime::GetOutputTensorInfo(NetworkId networkId, LayerBindingId laye
     return GetLoadedNetworkPtr(networkId)->GetOutputTensorInfo(layerId);
 }
 
+WorkingMemoryStatistics Runtime::GetWorkingMemoryStatistics(NetworkId networkId) const
+{
+    return GetLoadedNetworkPtr(networkId)->GetWorkingMemoryStatistics();
+}
+
 
 Status Runtime::EnqueueWorkload(NetworkId networkId,
                                 const InputTensors& inputTensors,
@@ -253,6 +273,57 @@ Status Runtime::EnqueueWorkload(NetworkId networkId,
     return loadedNetwork->EnqueueWorkload(inputTensors, outputTensors);
 }
 
+Threadpool& Runtime::GetThreadpool()
+{
+    std::lock_guard<std::mutex> lockGuard(m_ThreadpoolMutex);
+    if (!m_Threadpool)
+    {
+        unsigned int numThreads = m_AsyncExecutionThreads;
+        if (numThreads == 0)
+        {
+            numThreads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        m_Threadpool = std::make_unique<Threadpool>(*this, numThreads, m_AsyncQueueCapacity);
+    }
+    return *m_Threadpool;
+}
+
+std::future<Status> Runtime::EnqueueWorkloadAsync(NetworkId networkId,
+                                                  const InputTensors& inputTensors,
+                                                  const OutputTensors& outputTensors,
+                                                  QosExecPriority priority)
+{
+    auto promise = std::make_shared<std::promise<Status>>();
+    std::future<Status> future = promise->get_future();
+
+    GetThreadpool().Schedule(networkId, inputTensors, outputTensors, priority,
+                             [promise](Status status) { promise->set_value(status); });
+    return future;
+}
+
+void Runtime::EnqueueWorkloadAsync(NetworkId networkId,
+                                   const InputTensors& inputTensors,
+                                   const OutputTensors& outputTensors,
+                                   const AsyncExecutionCallback& callback,
+                                   QosExecPriority priority)
+{
+    GetThreadpool().Schedule(networkId, inputTensors, outputTensors, priority, callback);
+}
+
+std::unique_ptr<IWorkingMemHandle> Runtime::CreateWorkingMemHandle(NetworkId networkId)
+{
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+    return loadedNetwork->CreateWorkingMemHandle(networkId);
+}
+
+Status Runtime::Execute(IWorkingMemHandle& workingMemHandle,
+                        const InputTensors& inputTensors,
+                        const OutputTensors& outputTensors)
+{
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(workingMemHandle.GetNetworkId());
+    return loadedNetwork->Execute(inputTensors, outputTensors, workingMemHandle);
+}
+
 void Runtime::RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunction& func)
 {
     LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
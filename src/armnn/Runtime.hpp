@@ -6,6 +6,7 @@
 
 #include "LoadedNetwork.hpp"
 #include "DeviceSpec.hpp"
+#include "Threadpool.hpp"
 
 #include <armnn/INetwork.hpp>
 #include <armnn/IRuntime.hpp>
@@ -53,6 +54,24 @@ public:
         const InputTensors& inputTensors,
         const OutputTensors& outputTensors) override;
 
+    virtual std::future<Status> EnqueueWorkloadAsync(NetworkId networkId,
+                                                     const InputTensors& inputTensors,
+                                                     const OutputTensors& outputTensors,
+                                                     QosExecPriority priority) override;
+
+    virtual void EnqueueWorkloadAsync(NetworkId networkId,
+                                      const InputTensors& inputTensors,
+                                      const OutputTensors& outputTensors,
+                                      const AsyncExecutionCallback& callback,
+                                      QosExecPriority priority) override;
+
+    virtual std::unique_ptr<IWorkingMemHandle> CreateWorkingMemHandle(NetworkId networkId) override;
+
+    // Evaluates network using the intermediate tensors in workingMemHandle, concurrently with other handles.
+    virtual Status Execute(IWorkingMemHandle& workingMemHandle,
+                           const InputTensors& inputTensors,
+                           const OutputTensors& outputTensors) override;
+
     /// Unloads a network from the Runtime.
     /// At the moment this only removes the network from the m_Impl->m_Network.
     /// This might need more work in the future to be AndroidNN compliant.
@@ -62,6 +81,8 @@ public:
 
     virtual const IDeviceSpec& GetDeviceSpec() const override { return m_DeviceSpec; }
 
+    virtual WorkingMemoryStatistics GetWorkingMemoryStatistics(NetworkId networkId) const override;
+
     /// Gets the profiler corresponding to the given network id.
     /// @param networkId The id of the network for which to get the profile.
     /// @return A pointer to the requested profiler, or nullptr if not found.
@@ -86,6 +107,9 @@ private:
 
     LoadedNetwork* GetLoadedNetworkPtr(NetworkId networkId) const;
 
+    /// Returns the pool running the asynchronous requests, starting it on first use.
+    Threadpool& GetThreadpool();
+
     template<typename Func>
     void LoadedNetworkFuncSafe(NetworkId networkId, Func f)
     {
@@ -103,7 +127,7 @@ private:
     mutable std::mutex m_Mutex;
 
     std::unordered_map<NetworkId, std::unique_ptr<LoadedNetwork>> m_LoadedNetworks;
-    std::unordered_map<BackendId, IBackendInternal::IBackendContextPtr> m_BackendContexts;
+    LoadedNetwork::BackendContexts m_BackendContexts;
 
     int m_NetworkIdCounter;
 
@@ -111,6 +135,12 @@ private:
 
     /// List of dynamic backends loaded in the runtime
     std::vector<DynamicBackendPtr> m_DynamicBackends;
+
+    unsigned int m_AsyncExecutionThreads;
+    unsigned int m_AsyncQueueCapacity;
+
+    std::unique_ptr<Threadpool> m_Threadpool;
+    std::mutex m_ThreadpoolMutex;
 };
 
 } // namespace armnn
@@ -0,0 +1,221 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "Threadpool.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/log/trivial.hpp>
+
+#include <algorithm>
+
+namespace armnn
+{
+
+Threadpool::Threadpool(IRuntime& runtime, unsigned int numThreads, unsigned int queueCapacity)
+    : m_Runtime(runtime)
+    , m_QueueCapacity(queueCapacity)
+    , m_NextSequenceNumber(0)
+    , m_Stopping(false)
+{
+    if (numThreads == 0 || queueCapacity == 0)
+    {
+        throw InvalidArgumentException("Threadpool: the number of threads and the queue capacity must be non-zero");
+    }
+
+    m_Threads.reserve(numThreads);
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        m_Threads.emplace_back(&Threadpool::ProcessRequests, this);
+    }
+}
+
+Threadpool::~Threadpool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_RequestsMutex);
+        m_Stopping = true;
+    }
+    m_RequestAvailable.notify_all();
+    m_SpaceAvailable.notify_all();
+
+    for (auto& thread : m_Threads)
+    {
+        thread.join();
+    }
+}
+
+void Threadpool::Schedule(NetworkId networkId,
+                          const InputTensors& inputTensors,
+                          const OutputTensors& outputTensors,
+                          QosExecPriority priority,
+                          const AsyncExecutionCallback& callback)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_RequestsMutex);
+        m_SpaceAvailable.wait(lock, [this] { return m_Stopping || m_Requests.size() < m_QueueCapacity; });
+        if (m_Stopping)
+        {
+            throw RuntimeException("Threadpool: requests can't be scheduled while the pool is shutting down");
+        }
+
+        m_Requests.push_back(Request{ networkId, inputTensors, outputTensors, priority, m_NextSequenceNumber++,
+                                      callback });
+        std::push_heap(m_Requests.begin(), m_Requests.end(), RequestOrder());
+    }
+    m_RequestAvailable.notify_one();
+}
+
+void Threadpool::UnloadNetwork(NetworkId networkId)
+{
+    std::lock_guard<std::mutex> lock(m_WorkingMemHandlesMutex);
+    m_FreeWorkingMemHandles.erase(networkId);
+    m_SynchronousNetworks.erase(networkId);
+    if (m_NumWorkingMemHandlesInUse.count(networkId) != 0)
+    {
+        m_UnloadedNetworks.insert(networkId);
+    }
+}
+
+void Threadpool::ProcessRequests()
+{
+    while (true)
+    {
+        Request request{};
+        {
+            std::unique_lock<std::mutex> lock(m_RequestsMutex);
+            m_RequestAvailable.wait(lock, [this] { return m_Stopping || !m_Requests.empty(); });
+            if (m_Requests.empty())
+            {
+                // Only reached when stopping: the queued requests are always executed first.
+                return;
+            }
+
+            std::pop_heap(m_Requests.begin(), m_Requests.end(), RequestOrder());
+            request = std::move(m_Requests.back());
+            m_Requests.pop_back();
+        }
+        m_SpaceAvailable.notify_one();
+
+        const Status status = ExecuteRequest(request);
+
+        if (request.m_Callback)
+        {
+            try
+            {
+                request.m_Callback(status);
+            }
+            catch (const std::exception& error)
+            {
+                BOOST_LOG_TRIVIAL(error) << "Threadpool: the completion callback of a request threw an exception: "
+                                         << error.what();
+            }
+        }
+    }
+}
+
+Status Threadpool::ExecuteRequest(const Request& request)
+{
+    std::unique_ptr<IWorkingMemHandle> workingMemHandle;
+    try
+    {
+        workingMemHandle = AcquireWorkingMemHandle(request.m_NetworkId);
+    }
+    catch (const std::exception& error)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Threadpool: an error occurred creating the working memory of network "
+                                 << request.m_NetworkId << ": " << error.what();
+        return Status::Failure;
+    }
+
+    Status status = Status::Failure;
+    try
+    {
+        if (!workingMemHandle)
+        {
+            // EnqueueWorkload() serializes the requests on each network.
+            return m_Runtime.EnqueueWorkload(request.m_NetworkId, request.m_InputTensors, request.m_OutputTensors);
+        }
+
+        status = m_Runtime.Execute(*workingMemHandle, request.m_InputTensors, request.m_OutputTensors);
+    }
+    catch (const std::exception& error)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Threadpool: an error occurred executing a request on network "
+                                 << request.m_NetworkId << ": " << error.what();
+
+        // The working memory may have been left in any state.
+        workingMemHandle.reset();
+    }
+
+    ReleaseWorkingMemHandle(request.m_NetworkId, std::move(workingMemHandle));
+    return status;
+}
+
+std::unique_ptr<IWorkingMemHandle> Threadpool::AcquireWorkingMemHandle(NetworkId networkId)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_WorkingMemHandlesMutex);
+        if (m_SynchronousNetworks.count(networkId) != 0)
+        {
+            return nullptr;
+        }
+
+        ++m_NumWorkingMemHandlesInUse[networkId];
+
+        auto it = m_FreeWorkingMemHandles.find(networkId);
+        if (it != m_FreeWorkingMemHandles.end() && !it->second.empty())
+        {
+            std::unique_ptr<IWorkingMemHandle> workingMemHandle = std::move(it->second.back());
+            it->second.pop_back();
+            return workingMemHandle;
+        }
+    }
+
+    // Creating the working memory allocates all its tensors, so it is done without holding the lock.
+    try
+    {
+        return m_Runtime.CreateWorkingMemHandle(networkId);
+    }
+    catch (const InvalidArgumentException& error)
+    {
+        BOOST_LOG_TRIVIAL(info) << "Threadpool: network " << networkId
+                                << " will be executed one request at a time: " << error.what();
+
+        ReleaseWorkingMemHandle(networkId, nullptr);
+
+        std::lock_guard<std::mutex> lock(m_WorkingMemHandlesMutex);
+        m_SynchronousNetworks.insert(networkId);
+        return nullptr;
+    }
+    catch (...)
+    {
+        ReleaseWorkingMemHandle(networkId, nullptr);
+        throw;
+    }
+}
+
+void Threadpool::ReleaseWorkingMemHandle(NetworkId networkId, std::unique_ptr<IWorkingMemHandle> workingMemHandle)
+{
+    std::lock_guard<std::mutex> lock(m_WorkingMemHandlesMutex);
+
+    auto numInUse = m_NumWorkingMemHandlesInUse.find(networkId);
+    if (numInUse != m_NumWorkingMemHandlesInUse.end() && --numInUse->second == 0)
+    {
+        m_NumWorkingMemHandlesInUse.erase(numInUse);
+        if (m_UnloadedNetworks.erase(networkId) != 0)
+        {
+            // The last handle of an unloaded network: the id may be given to another network from now on.
+            return;
+        }
+    }
+
+    if (workingMemHandle && m_UnloadedNetworks.count(networkId) == 0)
+    {
+        m_FreeWorkingMemHandles[networkId].push_back(std::move(workingMemHandle));
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,102 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/IRuntime.hpp>
+#include <armnn/IWorkingMemHandle.hpp>
+#include <armnn/Types.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace armnn
+{
+
+/// Runs the inferences scheduled through IRuntime::EnqueueWorkloadAsync() on a fixed set of worker threads.
+/// Requests wait in a bounded queue, highest priority first and in submission order within a priority.
+/// Each worker runs its request on a working memory handle taken from a per-network free list, so a
+/// request can copy its inputs in while the previous ones are still running on other workers.
+class Threadpool
+{
+public:
+    Threadpool(IRuntime& runtime, unsigned int numThreads, unsigned int queueCapacity);
+
+    /// Waits for the queued requests to be executed before joining the worker threads.
+    ~Threadpool();
+
+    /// Adds a request to the queue, blocking while the queue is full.
+    void Schedule(NetworkId networkId,
+                  const InputTensors& inputTensors,
+                  const OutputTensors& outputTensors,
+                  QosExecPriority priority,
+                  const AsyncExecutionCallback& callback);
+
+    /// Frees the working memory cached for the given network.
+    void UnloadNetwork(NetworkId networkId);
+
+private:
+    struct Request
+    {
+        NetworkId m_NetworkId;
+        InputTensors m_InputTensors;
+        OutputTensors m_OutputTensors;
+        QosExecPriority m_Priority;
+        uint64_t m_SequenceNumber;
+        AsyncExecutionCallback m_Callback;
+    };
+
+    struct RequestOrder
+    {
+        bool operator()(const Request& lhs, const Request& rhs) const
+        {
+            if (lhs.m_Priority != rhs.m_Priority)
+            {
+                return lhs.m_Priority < rhs.m_Priority;
+            }
+            return lhs.m_SequenceNumber > rhs.m_SequenceNumber;
+        }
+    };
+
+    void ProcessRequests();
+
+    Status ExecuteRequest(const Request& request);
+
+    std::unique_ptr<IWorkingMemHandle> AcquireWorkingMemHandle(NetworkId networkId);
+
+    /// Returns a handle obtained from AcquireWorkingMemHandle() to the free list of the network, or just accounts for
+    /// it if it is null, i.e. if it couldn't be reused.
+    void ReleaseWorkingMemHandle(NetworkId networkId, std::unique_ptr<IWorkingMemHandle> workingMemHandle);
+
+    IRuntime& m_Runtime;
+    const size_t m_QueueCapacity;
+
+    // A heap ordered by RequestOrder, so that the next request can be moved out of it.
+    std::vector<Request> m_Requests;
+    uint64_t m_NextSequenceNumber;
+    bool m_Stopping;
+    std::mutex m_RequestsMutex;
+    std::condition_variable m_RequestAvailable;
+    std::condition_variable m_SpaceAvailable;
+
+    std::unordered_map<NetworkId, std::vector<std::unique_ptr<IWorkingMemHandle>>> m_FreeWorkingMemHandles;
+    // The number of handles of each network being used by a request.
+    std::unordered_map<NetworkId, unsigned int> m_NumWorkingMemHandlesInUse;
+    // Unloaded networks whose handles are still in use, which are dropped rather than reused once released.
+    std::unordered_set<NetworkId> m_UnloadedNetworks;
+    // Networks using backends which can't run on separate working memory fall back to EnqueueWorkload(),
+    // which runs one request at a time on each network.
+    std::unordered_set<NetworkId> m_SynchronousNetworks;
+    std::mutex m_WorkingMemHandlesMutex;
+
+    std::vector<std::thread> m_Threads;
+};
+
+} // namespace armnn
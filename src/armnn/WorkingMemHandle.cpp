@@ -0,0 +1,77 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "WorkingMemHandle.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/format.hpp>
+
+namespace armnn
+{
+
+WorkingMemHandle::WorkingMemHandle(NetworkId networkId,
+                                   std::vector<WorkingMemDescriptor> workingMemDescriptors,
+                                   std::unordered_map<LayerBindingId, ITensorHandle*> inputHandles,
+                                   std::unordered_map<LayerBindingId, ITensorHandle*> outputHandles,
+                                   std::vector<std::unique_ptr<ITensorHandle>> tensorHandles,
+                                   std::unique_ptr<TensorHandleFactoryRegistry> tensorHandleFactoryRegistry,
+                                   std::vector<std::shared_ptr<IMemoryManager>> memoryManagers)
+    : m_NetworkId(networkId)
+    , m_WorkingMemDescriptors(std::move(workingMemDescriptors))
+    , m_InputHandles(std::move(inputHandles))
+    , m_OutputHandles(std::move(outputHandles))
+    , m_TensorHandles(std::move(tensorHandles))
+    , m_TensorHandleFactoryRegistry(std::move(tensorHandleFactoryRegistry))
+    , m_MemoryManagers(std::move(memoryManagers))
+    , m_SizeInBytes(0)
+{
+    BOOST_ASSERT(m_TensorHandleFactoryRegistry);
+
+    m_TensorHandleFactoryRegistry->PlanMemory();
+    m_TensorHandleFactoryRegistry->AquireMemory();
+    m_SizeInBytes += m_TensorHandleFactoryRegistry->GetPlannedBytes();
+
+    for (auto&& memoryManager : m_MemoryManagers)
+    {
+        memoryManager->PlanMemory();
+        memoryManager->Acquire();
+        m_SizeInBytes += memoryManager->GetPlannedBytes();
+    }
+}
+
+WorkingMemHandle::~WorkingMemHandle()
+{
+    for (auto&& memoryManager : m_MemoryManagers)
+    {
+        memoryManager->Release();
+    }
+    m_TensorHandleFactoryRegistry->ReleaseMemory();
+}
+
+ITensorHandle* WorkingMemHandle::GetInputHandle(LayerBindingId layerBindingId) const
+{
+    auto it = m_InputHandles.find(layerBindingId);
+    if (it == m_InputHandles.end())
+    {
+        throw InvalidArgumentException(
+            boost::str(boost::format("No input layer is associated with id %1%") % layerBindingId));
+    }
+    return it->second;
+}
+
+ITensorHandle* WorkingMemHandle::GetOutputHandle(LayerBindingId layerBindingId) const
+{
+    auto it = m_OutputHandles.find(layerBindingId);
+    if (it == m_OutputHandles.end())
+    {
+        throw InvalidArgumentException(
+            boost::str(boost::format("No output layer is associated with id %1%") % layerBindingId));
+    }
+    return it->second;
+}
+
+} // namespace armnn
@@ -0,0 +1,68 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/IWorkingMemHandle.hpp>
+#include <armnn/Types.hpp>
+
+#include <backendsCommon/IMemoryManager.hpp>
+#include <backendsCommon/ITensorHandle.hpp>
+#include <backendsCommon/TensorHandleFactoryRegistry.hpp>
+#include <backendsCommon/WorkingMemDescriptor.hpp>
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace armnn
+{
+
+class WorkingMemHandle final : public IWorkingMemHandle
+{
+public:
+    /// @param workingMemDescriptors - The tensor handles of each workload, in the order of the workload queue.
+    /// @param inputHandles - The tensor handle receiving each network input.
+    /// @param outputHandles - The tensor handle holding each network output.
+    /// @param tensorHandles - The tensor handles owned by this working memory.
+    /// @param tensorHandleFactoryRegistry - The factories and memory managers of the tensor handles.
+    /// @param memoryManagers - The memory managers of the tensor handles created by the workload factories.
+    /// The memory of the managed tensor handles is planned and acquired on construction, and released on destruction.
+    WorkingMemHandle(NetworkId networkId,
+                     std::vector<WorkingMemDescriptor> workingMemDescriptors,
+                     std::unordered_map<LayerBindingId, ITensorHandle*> inputHandles,
+                     std::unordered_map<LayerBindingId, ITensorHandle*> outputHandles,
+                     std::vector<std::unique_ptr<ITensorHandle>> tensorHandles,
+                     std::unique_ptr<TensorHandleFactoryRegistry> tensorHandleFactoryRegistry,
+                     std::vector<std::shared_ptr<IMemoryManager>> memoryManagers);
+
+    ~WorkingMemHandle();
+
+    NetworkId GetNetworkId() const override { return m_NetworkId; }
+
+    size_t GetSizeInBytes() const override { return m_SizeInBytes; }
+
+    WorkingMemDescriptor& GetWorkingMemDescriptorAt(size_t id) { return m_WorkingMemDescriptors.at(id); }
+
+    ITensorHandle* GetInputHandle(LayerBindingId layerBindingId) const;
+
+    ITensorHandle* GetOutputHandle(LayerBindingId layerBindingId) const;
+
+private:
+    NetworkId m_NetworkId;
+
+    std::vector<WorkingMemDescriptor> m_WorkingMemDescriptors;
+
+    std::unordered_map<LayerBindingId, ITensorHandle*> m_InputHandles;
+    std::unordered_map<LayerBindingId, ITensorHandle*> m_OutputHandles;
+
+    std::vector<std::unique_ptr<ITensorHandle>> m_TensorHandles;
+
+    std::unique_ptr<TensorHandleFactoryRegistry> m_TensorHandleFactoryRegistry;
+    std::vector<std::shared_ptr<IMemoryManager>> m_MemoryManagers;
+
+    size_t m_SizeInBytes;
+};
+
+} // namespace armnn
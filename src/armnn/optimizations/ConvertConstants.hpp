@@ -27,7 +27,7 @@ struct Float16ToFloat32
         {
             std::vector<float> newValues(info.GetNumElements());
 
-            armnnUtils::FloatingPointConverter::ConvertFloat16To32(handle->GetTensor<Half>(),
+            armnnUtils::FloatingPointConverter::ConvertFloat16To32(handle->GetConstTensor<Half>(),
                                                                    info.GetNumElements(),
                                                                    newValues.data());
 
@@ -48,7 +48,7 @@ struct Float32ToFloat16
         {
             std::vector<Half> newValues(info.GetNumElements());
 
-            armnnUtils::FloatingPointConverter::ConvertFloat32To16(handle->GetTensor<float>(),
+            armnnUtils::FloatingPointConverter::ConvertFloat32To16(handle->GetConstTensor<float>(),
                                                                    info.GetNumElements(),
                                                                    newValues.data());
 
@@ -0,0 +1,157 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "FoldBatchNormIntoConvolution2d.hpp"
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <cmath>
+#include <vector>
+
+using namespace armnn;
+using namespace armnn::optimizations;
+
+namespace
+{
+
+bool IsFloat32(const ScopedCpuTensorHandle* tensor)
+{
+    return tensor != nullptr && tensor->GetTensorInfo().GetDataType() == DataType::Float32;
+}
+
+// The weights of a Convolution2d layer are [O, H, W, I] or [O, I, H, W].
+unsigned int GetNumOutputChannels(const Convolution2dLayer&, const TensorShape& weightShape)
+{
+    return weightShape[0];
+}
+
+unsigned int GetOutputChannel(const Convolution2dLayer&, const TensorShape& weightShape, unsigned int weightIndex)
+{
+    return weightIndex / (weightShape.GetNumElements() / weightShape[0]);
+}
+
+// The weights of a DepthwiseConvolution2d layer are [M, I, H, W], whatever the data layout, and input channel c
+// gives the output channels [c * M, c * M + M).
+unsigned int GetNumOutputChannels(const DepthwiseConvolution2dLayer&, const TensorShape& weightShape)
+{
+    return weightShape[0] * weightShape[1];
+}
+
+unsigned int GetOutputChannel(const DepthwiseConvolution2dLayer&,
+                              const TensorShape& weightShape,
+                              unsigned int weightIndex)
+{
+    const unsigned int depthMultiplier = weightShape[0];
+    const unsigned int inputChannels   = weightShape[1];
+    const unsigned int filterSize      = weightShape[2] * weightShape[3];
+
+    const unsigned int inputChannel      = (weightIndex / filterSize) % inputChannels;
+    const unsigned int multiplierChannel = weightIndex / (filterSize * inputChannels);
+    return inputChannel * depthMultiplier + multiplierChannel;
+}
+
+} // anonymous namespace
+
+template <typename ConvolutionLayer>
+void FoldBatchNormIntoConvolutionImpl<ConvolutionLayer>::Run(Graph& graph, InputSlot& connection) const
+{
+    Layer& base  = connection.GetConnectedOutputSlot()->GetOwningLayer();
+    Layer& child = connection.GetOwningLayer();
+
+    BOOST_ASSERT(base.GetType() == LayerEnumOf<ConvolutionLayer>());
+    BOOST_ASSERT(child.GetType() == LayerType::BatchNormalization);
+
+    auto& convolution = *boost::polymorphic_downcast<ConvolutionLayer*>(&base);
+    auto& batchNorm   = *boost::polymorphic_downcast<BatchNormalizationLayer*>(&child);
+
+    // The original convolution has to be left unconnected, otherwise it would still be computed.
+    if (base.GetOutputSlot().GetNumConnections() != 1 || convolution.m_FusedActivation.has_value())
+    {
+        return;
+    }
+
+    auto descriptor = convolution.GetParameters();
+    const BatchNormalizationDescriptor& batchNormDescriptor = batchNorm.GetParameters();
+    if (descriptor.m_DataLayout != batchNormDescriptor.m_DataLayout)
+    {
+        // The batch normalization wouldn't apply to the output channels of the convolution.
+        return;
+    }
+
+    const TensorInfo& outputInfo = child.GetOutputSlot().GetTensorInfo();
+    if (base.GetOutputSlot().GetTensorInfo().GetDataType() != DataType::Float32 ||
+        outputInfo.GetDataType() != DataType::Float32 ||
+        !IsFloat32(convolution.m_Weight.get()) ||
+        (descriptor.m_BiasEnabled && !IsFloat32(convolution.m_Bias.get())) ||
+        !IsFloat32(batchNorm.m_Mean.get()) ||
+        !IsFloat32(batchNorm.m_Variance.get()) ||
+        !IsFloat32(batchNorm.m_Beta.get()) ||
+        !IsFloat32(batchNorm.m_Gamma.get()))
+    {
+        return;
+    }
+
+    const TensorInfo& weightInfo = convolution.m_Weight->GetTensorInfo();
+    const unsigned int numChannels = GetNumOutputChannels(convolution, weightInfo.GetShape());
+    if (batchNorm.m_Mean->GetTensorInfo().GetNumElements() != numChannels)
+    {
+        return;
+    }
+
+    // output = gamma * (weights * input + bias - mean) / sqrt(variance + eps) + beta
+    //        = (scale * weights) * input + (scale * (bias - mean) + beta), with scale = gamma / sqrt(variance + eps)
+    const float* mean     = batchNorm.m_Mean->GetConstTensor<float>();
+    const float* variance = batchNorm.m_Variance->GetConstTensor<float>();
+    const float* beta     = batchNorm.m_Beta->GetConstTensor<float>();
+    const float* gamma    = batchNorm.m_Gamma->GetConstTensor<float>();
+    const float* bias     = descriptor.m_BiasEnabled ? convolution.m_Bias->template GetConstTensor<float>() : nullptr;
+
+    std::vector<float> scales(numChannels);
+    std::vector<float> foldedBias(numChannels);
+    for (unsigned int c = 0; c < numChannels; ++c)
+    {
+        scales[c] = gamma[c] / std::sqrt(variance[c] + batchNormDescriptor.m_Eps);
+        foldedBias[c] = scales[c] * ((bias ? bias[c] : 0.0f) - mean[c]) + beta[c];
+    }
+
+    const float* weights = convolution.m_Weight->template GetConstTensor<float>();
+    std::vector<float> foldedWeights(weightInfo.GetNumElements());
+    for (unsigned int i = 0; i < foldedWeights.size(); ++i)
+    {
+        foldedWeights[i] = weights[i] * scales[GetOutputChannel(convolution, weightInfo.GetShape(), i)];
+    }
+
+    OutputSlot* parentOut = base.GetInputSlot(0).GetConnectedOutputSlot();
+
+    const std::string name = std::string("folded-") + child.GetName() + std::string("-into-") + base.GetName();
+    descriptor.m_BiasEnabled = true;
+
+    auto& newConvolution = *graph.InsertNewLayer<ConvolutionLayer>(base.GetInputSlot(0), descriptor, name.c_str());
+    newConvolution.GetOutputHandler().SetTensorInfo(outputInfo);
+
+    newConvolution.m_Weight = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(weightInfo, foldedWeights));
+    newConvolution.m_Bias = std::make_unique<ScopedCpuTensorHandle>(
+        ConstTensor(TensorInfo({ numChannels }, DataType::Float32), foldedBias));
+
+    // Reconnects the original convolution with its parent, so that it is left unconnected once the batch
+    // normalization is.
+    newConvolution.GetOutputSlot().MoveAllConnections(*parentOut);
+
+    // Moves connections in child output to the new convolution.
+    // Child layer will be removed as it's left unconnected.
+    // Base layer will be removed if left unconnected.
+    child.GetOutputSlot().MoveAllConnections(newConvolution.GetOutputSlot());
+}
+
+namespace armnn
+{
+namespace optimizations
+{
+
+template class FoldBatchNormIntoConvolutionImpl<Convolution2dLayer>;
+template class FoldBatchNormIntoConvolutionImpl<DepthwiseConvolution2dLayer>;
+
+} // namespace optimizations
+} // namespace armnn
@@ -0,0 +1,41 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Optimization.hpp"
+
+namespace armnn
+{
+namespace optimizations
+{
+
+/// Replaces a Convolution2d or DepthwiseConvolution2d layer followed by a BatchNormalization layer with a single
+/// convolution, whose weights and bias are those of the original convolution scaled and shifted per output channel
+/// by the batch normalization.
+/// The layers are only folded when the batch normalization is the only consumer of the convolution, both use the same
+/// data layout and all their tensors are Float32.
+template <typename ConvolutionLayer>
+class FoldBatchNormIntoConvolutionImpl
+{
+public:
+    void Run(Graph& graph, InputSlot& connection) const;
+
+protected:
+    FoldBatchNormIntoConvolutionImpl() = default;
+    ~FoldBatchNormIntoConvolutionImpl() = default;
+};
+
+using FoldBatchNormIntoConvolution2d =
+    OptimizeForConnection<Convolution2dLayer,
+                          BatchNormalizationLayer,
+                          FoldBatchNormIntoConvolutionImpl<Convolution2dLayer>>;
+
+using FoldBatchNormIntoDepthwiseConvolution2d =
+    OptimizeForConnection<DepthwiseConvolution2dLayer,
+                          BatchNormalizationLayer,
+                          FoldBatchNormIntoConvolutionImpl<DepthwiseConvolution2dLayer>>;
+
+} // namespace optimizations
+} // namespace armnn
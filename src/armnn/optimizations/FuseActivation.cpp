@@ -0,0 +1,85 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "FuseActivation.hpp"
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+using namespace armnn;
+using namespace armnn::optimizations;
+
+namespace
+{
+
+// The activations which clamp their input to a range, which is all the layers apply as they store their outputs.
+bool IsFusableActivation(ActivationFunction function)
+{
+    return function == ActivationFunction::ReLu || function == ActivationFunction::BoundedReLu;
+}
+
+} // anonymous namespace
+
+template <typename BaseType>
+void FuseActivationImpl<BaseType>::Run(Graph& graph, InputSlot& connection) const
+{
+    Layer& base  = connection.GetConnectedOutputSlot()->GetOwningLayer();
+    Layer& child = connection.GetOwningLayer();
+
+    BOOST_ASSERT(base.GetType() == LayerEnumOf<BaseType>());
+    BOOST_ASSERT(child.GetType() == LayerType::Activation);
+
+    auto& layer      = *boost::polymorphic_downcast<BaseType*>(&base);
+    auto& activation = *boost::polymorphic_downcast<ActivationLayer*>(&child);
+
+    // The original layer has to be left unconnected, otherwise it would still be computed.
+    if (base.GetOutputSlot().GetNumConnections() != 1 || layer.m_FusedActivation.has_value())
+    {
+        return;
+    }
+
+    if (base.GetBackendId() != child.GetBackendId() || m_Backends.find(base.GetBackendId()) == m_Backends.end())
+    {
+        return;
+    }
+
+    const ActivationDescriptor& activationDescriptor = activation.GetParameters();
+    const TensorInfo& outputInfo = child.GetOutputSlot().GetTensorInfo();
+    if (!IsFusableActivation(activationDescriptor.m_Function) || outputInfo != base.GetOutputSlot().GetTensorInfo())
+    {
+        return;
+    }
+
+    OutputSlot* parentOut = base.GetInputSlot(0).GetConnectedOutputSlot();
+
+    const std::string name = std::string("fused-") + child.GetName() + std::string("-into-") + base.GetName();
+
+    auto& newLayer = *graph.InsertNewLayer<BaseType>(base.GetInputSlot(0), layer.GetParameters(), name.c_str());
+    newLayer.GetOutputHandler().SetTensorInfo(outputInfo);
+    newLayer.SetBackendId(base.GetBackendId());
+
+    newLayer.m_Weight = std::move(layer.m_Weight);
+    newLayer.m_Bias = std::move(layer.m_Bias);
+    newLayer.m_FusedActivation = activationDescriptor;
+
+    // Reconnects the original layer with its parent, so that it is left unconnected once the activation is.
+    newLayer.GetOutputSlot().MoveAllConnections(*parentOut);
+
+    // Moves connections in child output to the new layer.
+    // Child layer will be removed as it's left unconnected.
+    // Base layer will be removed if left unconnected.
+    child.GetOutputSlot().MoveAllConnections(newLayer.GetOutputSlot());
+}
+
+namespace armnn
+{
+namespace optimizations
+{
+
+template class FuseActivationImpl<Convolution2dLayer>;
+template class FuseActivationImpl<DepthwiseConvolution2dLayer>;
+template class FuseActivationImpl<FullyConnectedLayer>;
+
+} // namespace optimizations
+} // namespace armnn
@@ -0,0 +1,50 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Optimization.hpp"
+
+#include <armnn/BackendId.hpp>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+/// Replaces a Convolution2d, DepthwiseConvolution2d or FullyConnected layer followed by a ReLu or BoundedReLu
+/// Activation layer with a copy of the layer which clamps its outputs as it stores them (see m_FusedActivation).
+/// Backends have to apply the fused activations, so this runs once backends have been assigned to the layers and only
+/// fuses the activations which run on the same backend as the layer before them, when it is one of the given backends.
+/// The activation must be the only consumer of the layer, and its output must have the same tensor info as the layer's.
+template <typename BaseType>
+class FuseActivationImpl
+{
+public:
+    explicit FuseActivationImpl(const BackendIdSet& backends)
+        : m_Backends(backends)
+    {}
+
+    void Run(Graph& graph, InputSlot& connection) const;
+
+protected:
+    ~FuseActivationImpl() = default;
+
+private:
+    BackendIdSet m_Backends;
+};
+
+using FuseActivationIntoConvolution2d =
+    OptimizeForConnection<Convolution2dLayer, ActivationLayer, FuseActivationImpl<Convolution2dLayer>>;
+
+using FuseActivationIntoDepthwiseConvolution2d =
+    OptimizeForConnection<DepthwiseConvolution2dLayer,
+                          ActivationLayer,
+                          FuseActivationImpl<DepthwiseConvolution2dLayer>>;
+
+using FuseActivationIntoFullyConnected =
+    OptimizeForConnection<FullyConnectedLayer, ActivationLayer, FuseActivationImpl<FullyConnectedLayer>>;
+
+} // namespace optimizations
+} // namespace armnn
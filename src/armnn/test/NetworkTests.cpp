@@ -9,6 +9,10 @@
 #include <armnn/LayerVisitorBase.hpp>
 #include <Network.hpp>
 
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <boost/polymorphic_cast.hpp>
+
 #include <boost/test/unit_test.hpp>
 
 namespace
@@ -539,4 +543,71 @@ BOOST_AUTO_TEST_CASE(StandInLayerSingleInputMultipleOutputsNetworkTest)
     BOOST_TEST(standIn->GetOutputSlot(1).GetConnection(0) == &output1->GetInputSlot(0));
 }
 
+BOOST_AUTO_TEST_CASE(ShareConstantMemory)
+{
+    const armnn::TensorInfo info({ 2, 3 }, armnn::DataType::Float32);
+    auto sharedData = std::make_shared<std::vector<float>>(2 * info.GetNumElements(), 1.0f);
+    std::vector<float> otherData(info.GetNumElements(), 2.0f);
+
+    armnn::Network net;
+    net.ShareConstantMemory(sharedData, sharedData->data(), sharedData->size() * sizeof(float));
+
+    // The second half of the shared memory, and memory outside of it.
+    net.AddConstantLayer(armnn::ConstTensor(info, sharedData->data() + info.GetNumElements()), "shared");
+    net.AddConstantLayer(armnn::ConstTensor(info, otherData), "copied");
+
+    for (const armnn::Layer* layer : net.GetGraph())
+    {
+        auto constantLayer = boost::polymorphic_downcast<const armnn::ConstantLayer*>(layer);
+        const float* data = constantLayer->m_LayerOutput->GetConstTensor<float>();
+        if (std::string(layer->GetName()) == "shared")
+        {
+            BOOST_TEST(data == sharedData->data() + info.GetNumElements());
+
+            // Copies of the handle, as made when the graph is optimized or workloads are created, share it too.
+            armnn::ScopedCpuTensorHandle copy(*constantLayer->m_LayerOutput);
+            BOOST_TEST(copy.GetConstTensor<float>() == data);
+        }
+        else
+        {
+            BOOST_TEST(data != otherData.data());
+            BOOST_TEST(data[0] == 2.0f);
+        }
+    }
+
+    // The shared memory is kept alive by the network.
+    std::weak_ptr<std::vector<float>> weakSharedData = sharedData;
+    sharedData.reset();
+    BOOST_TEST(!weakSharedData.expired());
+}
+
+BOOST_AUTO_TEST_CASE(WritingSharedConstantMemoryCopiesIt)
+{
+    const armnn::TensorInfo info({ 2, 3 }, armnn::DataType::Float32);
+    auto sharedData = std::make_shared<std::vector<float>>(info.GetNumElements(), 1.0f);
+
+    armnn::Network net;
+    net.ShareConstantMemory(sharedData, sharedData->data(), sharedData->size() * sizeof(float));
+    armnn::IConnectableLayer* layer = net.AddConstantLayer(armnn::ConstTensor(info, sharedData->data()), "shared");
+    const armnn::ScopedCpuTensorHandle& handle =
+        *boost::polymorphic_downcast<armnn::ConstantLayer*>(layer)->m_LayerOutput;
+
+    // As done by an optimization transforming the constants of one optimized network in place.
+    armnn::ScopedCpuTensorHandle writtenCopy(handle);
+    armnn::ScopedCpuTensorHandle readCopy(handle);
+    BOOST_TEST(writtenCopy.IsMemoryShared());
+
+    float* writtenData = writtenCopy.GetTensor<float>();
+    BOOST_TEST(!writtenCopy.IsMemoryShared());
+    BOOST_TEST(writtenData != sharedData->data());
+    BOOST_TEST(writtenData[0] == 1.0f);
+    writtenData[0] = 2.0f;
+
+    // The shared memory, and the other handles referring to it, are unaffected.
+    BOOST_TEST((*sharedData)[0] == 1.0f);
+    BOOST_TEST(readCopy.IsMemoryShared());
+    BOOST_TEST(readCopy.GetConstTensor<float>() == sharedData->data());
+    BOOST_TEST(handle.GetConstTensor<float>()[0] == 1.0f);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,289 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <armnn/ArmNN.hpp>
+#include <Network.hpp>
+#include <OptimizedNetworkCache.hpp>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+
+using namespace armnn;
+
+INetworkPtr CreateNetwork()
+{
+    const TensorInfo info({ 1, 4 }, DataType::Float32);
+
+    ActivationDescriptor descriptor;
+    descriptor.m_Function = ActivationFunction::ReLu;
+
+    INetworkPtr network = INetwork::Create();
+    IConnectableLayer* input      = network->AddInputLayer(0, "input");
+    IConnectableLayer* activation = network->AddActivationLayer(descriptor, "activation");
+    IConnectableLayer* output     = network->AddOutputLayer(0, "output");
+
+    input->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(info);
+    activation->GetOutputSlot(0).SetTensorInfo(info);
+
+    return network;
+}
+
+// The reference backend doesn't support permutes in Float16, so the backend assignment inserts conversion layers
+// around it.
+INetworkPtr CreateFloat16Network()
+{
+    INetworkPtr network = INetwork::Create();
+    IConnectableLayer* input   = network->AddInputLayer(0, "input");
+    IConnectableLayer* permute = network->AddPermuteLayer(PermuteDescriptor({ 1, 0 }), "permute");
+    IConnectableLayer* output  = network->AddOutputLayer(0, "output");
+
+    input->GetOutputSlot(0).Connect(permute->GetInputSlot(0));
+    permute->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 2, 3 }, DataType::Float16));
+    permute->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 3, 2 }, DataType::Float16));
+
+    return network;
+}
+
+INetworkPtr CreateConstantNetwork(float value)
+{
+    const TensorInfo info({ 1, 4 }, DataType::Float32);
+    const std::vector<float> data(4, value);
+
+    INetworkPtr network = INetwork::Create();
+    IConnectableLayer* constant = network->AddConstantLayer(ConstTensor(info, data.data()), "constant");
+    IConnectableLayer* output   = network->AddOutputLayer(0, "output");
+
+    constant->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    constant->GetOutputSlot(0).SetTensorInfo(info);
+
+    return network;
+}
+
+uint64_t GetKey(const std::string& directory, INetwork& network, const IRuntime& runtime)
+{
+    const std::vector<BackendId> backends = { Compute::CpuRef };
+    armnn::OptimizedNetworkCache cache(directory,
+                                       boost::polymorphic_downcast<Network*>(&network)->GetGraph(),
+                                       BackendSettings(backends, runtime.GetDeviceSpec()),
+                                       OptimizerOptions());
+    return cache.GetKey();
+}
+
+class TemporaryDirectory
+{
+public:
+    TemporaryDirectory()
+        : m_Path(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%-%%%%"))
+    {
+        boost::filesystem::create_directories(m_Path);
+    }
+
+    ~TemporaryDirectory()
+    {
+        boost::filesystem::remove_all(m_Path);
+    }
+
+    std::string GetPath() const { return m_Path.string(); }
+
+private:
+    boost::filesystem::path m_Path;
+};
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(OptimizedNetworkCache)
+
+BOOST_AUTO_TEST_CASE(OptimizeStoresAndReusesTheDecisions)
+{
+    TemporaryDirectory cacheDirectory;
+    IRuntimePtr runtime = IRuntime::Create(IRuntime::CreationOptions());
+    const std::vector<BackendId> backends = { Compute::CpuRef };
+
+    INetworkPtr network = CreateNetwork();
+    OptimizerOptions options;
+    options.m_CacheDirectory = cacheDirectory.GetPath();
+
+    armnn::OptimizedNetworkCache cache(cacheDirectory.GetPath(),
+                                       boost::polymorphic_downcast<Network*>(network.get())->GetGraph(),
+                                       BackendSettings(backends, runtime->GetDeviceSpec()),
+                                       options);
+    BOOST_TEST(!boost::filesystem::exists(cache.GetFilePath()));
+
+    IOptimizedNetworkPtr optNet = Optimize(*network, backends, runtime->GetDeviceSpec(), options);
+    BOOST_REQUIRE(optNet);
+    BOOST_TEST(boost::filesystem::exists(cache.GetFilePath()));
+
+    // Changes the stored tensor handle factories to the legacy one, to tell restored decisions from new ones.
+    const Graph& optGraph = boost::polymorphic_downcast<OptimizedNetwork*>(optNet.get())->GetGraph();
+    const std::string factoryId = (*optGraph.GetInputLayers().begin())->GetOutputSlot(0).GetTensorHandleFactoryId();
+    BOOST_TEST_REQUIRE(factoryId != ITensorHandleFactory::LegacyFactoryId);
+
+    std::string contents;
+    {
+        std::ifstream file(cache.GetFilePath());
+        contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    for (size_t pos = contents.find(factoryId); pos != std::string::npos; pos = contents.find(factoryId, pos))
+    {
+        contents.replace(pos, factoryId.size(), ITensorHandleFactory::LegacyFactoryId);
+    }
+    {
+        std::ofstream file(cache.GetFilePath());
+        file << contents;
+    }
+
+    // The second optimization restores the decisions, and the network can be loaded and run.
+    optNet = Optimize(*network, backends, runtime->GetDeviceSpec(), options);
+    BOOST_REQUIRE(optNet);
+    for (const Layer* layer : boost::polymorphic_downcast<OptimizedNetwork*>(optNet.get())->GetGraph())
+    {
+        BOOST_CHECK(layer->GetBackendId() == Compute::CpuRef);
+        for (const OutputSlot& outputSlot : layer->GetOutputSlots())
+        {
+            BOOST_TEST(outputSlot.GetTensorHandleFactoryId() == ITensorHandleFactory::LegacyFactoryId);
+        }
+    }
+
+    NetworkId networkId;
+    BOOST_CHECK(runtime->LoadNetwork(networkId, std::move(optNet)) == Status::Success);
+
+    std::vector<float> inputData({ -1.0f, 2.0f, -3.0f, 4.0f });
+    std::vector<float> outputData(4);
+    InputTensors inputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(networkId, 0), inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) } };
+    BOOST_CHECK(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == Status::Success);
+    BOOST_TEST(outputData == std::vector<float>({ 0.0f, 2.0f, 0.0f, 4.0f }), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(KeyDependsOnTheWholeNetwork)
+{
+    TemporaryDirectory cacheDirectory;
+    IRuntimePtr runtime = IRuntime::Create(IRuntime::CreationOptions());
+
+    INetworkPtr network = CreateNetwork();
+    INetworkPtr sameNetwork = CreateNetwork();
+    BOOST_TEST(GetKey(cacheDirectory.GetPath(), *network, *runtime) ==
+               GetKey(cacheDirectory.GetPath(), *sameNetwork, *runtime));
+
+    // Another network, even if it only has an additional layer, has another key.
+    INetworkPtr otherNetwork = CreateNetwork();
+    otherNetwork->AddOutputLayer(1, "unconnected");
+    BOOST_TEST(GetKey(cacheDirectory.GetPath(), *network, *runtime) !=
+               GetKey(cacheDirectory.GetPath(), *otherNetwork, *runtime));
+
+    // So does a network which only differs by the values of its constants.
+    INetworkPtr constantNetwork = CreateConstantNetwork(1.0f);
+    INetworkPtr sameConstantNetwork = CreateConstantNetwork(1.0f);
+    INetworkPtr otherConstantNetwork = CreateConstantNetwork(2.0f);
+    BOOST_TEST(GetKey(cacheDirectory.GetPath(), *constantNetwork, *runtime) ==
+               GetKey(cacheDirectory.GetPath(), *sameConstantNetwork, *runtime));
+    BOOST_TEST(GetKey(cacheDirectory.GetPath(), *constantNetwork, *runtime) !=
+               GetKey(cacheDirectory.GetPath(), *otherConstantNetwork, *runtime));
+}
+
+BOOST_AUTO_TEST_CASE(RestoreAssignsTheStoredDecisions)
+{
+    TemporaryDirectory cacheDirectory;
+    IRuntimePtr runtime = IRuntime::Create(IRuntime::CreationOptions());
+    const std::vector<BackendId> backends = { Compute::CpuRef };
+
+    INetworkPtr network = CreateNetwork();
+    IOptimizedNetworkPtr optNet = Optimize(*network, backends, runtime->GetDeviceSpec());
+    BOOST_REQUIRE(optNet);
+    const Graph& optGraph = boost::polymorphic_downcast<OptimizedNetwork*>(optNet.get())->GetGraph();
+
+    const Graph& networkGraph = boost::polymorphic_downcast<Network*>(network.get())->GetGraph();
+    Graph graph(networkGraph);
+    BackendSettings backendSettings(backends, runtime->GetDeviceSpec());
+
+    // Nothing to restore yet.
+    armnn::OptimizedNetworkCache cache(cacheDirectory.GetPath(), graph, backendSettings, OptimizerOptions());
+    BOOST_TEST(!cache.RestoreBackends(graph, backendSettings));
+    BOOST_TEST(!cache.RestoreTensorHandleStrategies(graph));
+
+    for (Layer* layer : graph)
+    {
+        layer->SetBackendId(Compute::CpuRef);
+    }
+    BOOST_TEST(cache.RecordBackends(graph));
+    cache.RecordTensorHandleStrategies(optGraph);
+    cache.Store();
+
+    Graph restoredGraph(networkGraph);
+    armnn::OptimizedNetworkCache storedCache(cacheDirectory.GetPath(), restoredGraph, backendSettings,
+                                             OptimizerOptions());
+    BOOST_TEST(storedCache.RestoreBackends(restoredGraph, backendSettings));
+    BOOST_TEST(storedCache.RestoreTensorHandleStrategies(restoredGraph));
+    BOOST_TEST(backendSettings.IsBackendSelected(Compute::CpuRef));
+
+    for (const Layer* layer : restoredGraph)
+    {
+        BOOST_CHECK(layer->GetBackendId() == Compute::CpuRef);
+        for (const OutputSlot& outputSlot : layer->GetOutputSlots())
+        {
+            BOOST_TEST(outputSlot.GetTensorHandleFactoryId() != ITensorHandleFactory::LegacyFactoryId);
+            BOOST_CHECK(outputSlot.GetEdgeStrategyForConnection(0) == EdgeStrategy::DirectCompatibility);
+        }
+    }
+
+    // A corrupted file is ignored.
+    {
+        std::ofstream file(cache.GetFilePath());
+        file << "ArmNN optimized network cache\n" << armnn::OptimizedNetworkCache::Version << "\ngarbage\n";
+    }
+    Graph otherGraph(networkGraph);
+    armnn::OptimizedNetworkCache corruptedCache(cacheDirectory.GetPath(), otherGraph, backendSettings,
+                                                OptimizerOptions());
+    BOOST_TEST(!corruptedCache.RestoreBackends(otherGraph, backendSettings));
+}
+
+BOOST_AUTO_TEST_CASE(RestoreInsertsTheStoredConversionLayers)
+{
+    TemporaryDirectory cacheDirectory;
+    IRuntimePtr runtime = IRuntime::Create(IRuntime::CreationOptions());
+    const std::vector<BackendId> backends = { Compute::CpuRef };
+
+    INetworkPtr network = CreateFloat16Network();
+    OptimizerOptions options;
+    options.m_CacheDirectory = cacheDirectory.GetPath();
+
+    IOptimizedNetworkPtr optNet = Optimize(*network, backends, runtime->GetDeviceSpec(), options);
+    BOOST_REQUIRE(optNet);
+    BOOST_TEST(boost::polymorphic_downcast<OptimizedNetwork*>(optNet.get())->GetGraph().GetNumLayers() == 5);
+
+    // The stored decisions insert the conversion layers in a copy of the network graph.
+    const Graph& networkGraph = boost::polymorphic_downcast<Network*>(network.get())->GetGraph();
+    Graph graph(networkGraph);
+    BackendSettings backendSettings(backends, runtime->GetDeviceSpec());
+    armnn::OptimizedNetworkCache cache(cacheDirectory.GetPath(), graph, backendSettings, options);
+    BOOST_TEST_REQUIRE(cache.RestoreBackends(graph, backendSettings));
+
+    BOOST_TEST(graph.GetNumLayers() == 5);
+    for (const Layer* layer : graph)
+    {
+        BOOST_CHECK(layer->GetBackendId() == Compute::CpuRef);
+    }
+    const Layer* input = *graph.GetInputLayers().begin();
+    BOOST_CHECK(input->GetOutputSlot(0).GetConnection(0)->GetOwningLayer().GetType() == LayerType::ConvertFp16ToFp32);
+
+    // A restored optimization gives the same network.
+    IOptimizedNetworkPtr restoredOptNet = Optimize(*network, backends, runtime->GetDeviceSpec(), options);
+    BOOST_REQUIRE(restoredOptNet);
+    BOOST_TEST(boost::polymorphic_downcast<OptimizedNetwork*>(restoredOptNet.get())->GetGraph().GetNumLayers() == 5);
+
+    NetworkId networkId;
+    BOOST_CHECK(runtime->LoadNetwork(networkId, std::move(restoredOptNet)) == Status::Success);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
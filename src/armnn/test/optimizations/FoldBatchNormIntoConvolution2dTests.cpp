@@ -0,0 +1,210 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "../TestUtils.hpp"
+
+#include <Network.hpp>
+#include <Optimizer.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace armnn;
+
+BOOST_AUTO_TEST_SUITE(Optimizer)
+using namespace armnn::optimizations;
+
+namespace
+{
+
+const TensorInfo g_InputInfo({ 1, 1, 2, 2 }, DataType::Float32);
+
+/// Input (NHWC, 1x1x2x2) -> convolution -> batch normalization -> output. The convolution is either a 1x1
+/// Convolution2d with two output channels and a bias, or a 1x1 DepthwiseConvolution2d with a depth multiplier of
+/// two and no bias.
+INetworkPtr CreateTestNetwork(bool depthwise)
+{
+    INetworkPtr network = INetwork::Create();
+
+    auto input = network->AddInputLayer(0, "input");
+    input->GetOutputSlot(0).SetTensorInfo(g_InputInfo);
+
+    IConnectableLayer* convolution = nullptr;
+    unsigned int numChannels = 0;
+    if (depthwise)
+    {
+        DepthwiseConvolution2dDescriptor descriptor;
+        descriptor.m_DataLayout = DataLayout::NHWC;
+        descriptor.m_BiasEnabled = false;
+
+        std::vector<float> weightsData{ 1.0f, 2.0f, 3.0f, 4.0f };
+        ConstTensor weights(TensorInfo({ 2, 2, 1, 1 }, DataType::Float32), weightsData);
+        convolution = network->AddDepthwiseConvolution2dLayer(descriptor, weights, EmptyOptional(), "conv");
+        numChannels = 4;
+    }
+    else
+    {
+        Convolution2dDescriptor descriptor;
+        descriptor.m_DataLayout = DataLayout::NHWC;
+        descriptor.m_BiasEnabled = true;
+
+        std::vector<float> weightsData{ 1.0f, 2.0f, 3.0f, -1.0f };
+        std::vector<float> biasData{ 0.5f, -0.5f };
+        ConstTensor weights(TensorInfo({ 2, 1, 1, 2 }, DataType::Float32), weightsData);
+        ConstTensor bias(TensorInfo({ 2 }, DataType::Float32), biasData);
+        convolution = network->AddConvolution2dLayer(descriptor, weights, Optional<ConstTensor>(bias), "conv");
+        numChannels = 2;
+    }
+
+    const TensorInfo outputInfo({ 1, 1, 2, numChannels }, DataType::Float32);
+    convolution->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    input->GetOutputSlot(0).Connect(convolution->GetInputSlot(0));
+
+    // The batch normalization computes (3 * (x - 1) / 2 + 1, (x - 0.5) / 0.5 - 1) from the two channels of the
+    // Convolution2d, and (x, 2 * x, 3 * x, 4 * x + 1) from the four channels of the DepthwiseConvolution2d.
+    std::vector<float> meanData{ 1.0f, 0.5f };
+    std::vector<float> varianceData{ 4.0f, 0.25f };
+    std::vector<float> betaData{ 1.0f, -1.0f };
+    std::vector<float> gammaData{ 3.0f, 1.0f };
+    if (depthwise)
+    {
+        meanData     = { 0.0f, 0.0f, 0.0f, 0.0f };
+        varianceData = { 1.0f, 1.0f, 1.0f, 1.0f };
+        betaData     = { 0.0f, 0.0f, 0.0f, 1.0f };
+        gammaData    = { 1.0f, 2.0f, 3.0f, 4.0f };
+    }
+
+    const TensorInfo channelInfo({ numChannels }, DataType::Float32);
+    BatchNormalizationDescriptor batchNormDescriptor;
+    batchNormDescriptor.m_DataLayout = DataLayout::NHWC;
+    batchNormDescriptor.m_Eps = 0.0f;
+    auto batchNorm = network->AddBatchNormalizationLayer(batchNormDescriptor,
+                                                         ConstTensor(channelInfo, meanData),
+                                                         ConstTensor(channelInfo, varianceData),
+                                                         ConstTensor(channelInfo, betaData),
+                                                         ConstTensor(channelInfo, gammaData),
+                                                         "batchNorm");
+    batchNorm->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    convolution->GetOutputSlot(0).Connect(batchNorm->GetInputSlot(0));
+
+    auto output = network->AddOutputLayer(0, "output");
+    batchNorm->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    return network;
+}
+
+/// Runs the network on the reference backend, checking that the batch normalization has been folded, and returns
+/// its output for the input pixels (1, 2) and (3, 4).
+std::vector<float> RunFoldedNetwork(bool depthwise)
+{
+    INetworkPtr network = CreateTestNetwork(depthwise);
+
+    IRuntimePtr runtime = IRuntime::Create(IRuntime::CreationOptions());
+    IOptimizedNetworkPtr optimizedNetwork = Optimize(*network, { Compute::CpuRef }, runtime->GetDeviceSpec());
+
+    const Graph& optGraph = static_cast<OptimizedNetwork*>(optimizedNetwork.get())->GetGraph();
+    if (depthwise)
+    {
+        BOOST_TEST(CheckSequence(optGraph.cbegin(), optGraph.cend(), &IsLayerOfType<InputLayer>,
+                                 &IsLayerOfType<DepthwiseConvolution2dLayer>, &IsLayerOfType<OutputLayer>));
+    }
+    else
+    {
+        BOOST_TEST(CheckSequence(optGraph.cbegin(), optGraph.cend(), &IsLayerOfType<InputLayer>,
+                                 &IsLayerOfType<Convolution2dLayer>, &IsLayerOfType<OutputLayer>));
+    }
+
+    NetworkId netId;
+    runtime->LoadNetwork(netId, std::move(optimizedNetwork));
+
+    std::vector<float> inputData{ 1.0f, 2.0f, 3.0f, 4.0f };
+    std::vector<float> outputData(depthwise ? 8 : 4);
+    InputTensors inputs{ { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData) } };
+    OutputTensors outputs{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) } };
+    runtime->EnqueueWorkload(netId, inputs, outputs);
+
+    return outputData;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(FoldBatchNormIntoConvolution2dOptimizerTest)
+{
+    INetworkPtr network = CreateTestNetwork(false);
+    Graph graph         = static_cast<Network*>(network.get())->GetGraph();
+
+    BOOST_TEST(CheckSequence(graph.cbegin(), graph.cend(), &IsLayerOfType<InputLayer>,
+                             &IsLayerOfType<Convolution2dLayer>, &IsLayerOfType<BatchNormalizationLayer>,
+                             &IsLayerOfType<OutputLayer>));
+
+    armnn::Optimizer::Pass(graph, MakeOptimizations(FoldBatchNormIntoConvolution2d()));
+
+    // scale = gamma / sqrt(variance), weights *= scale, bias = scale * (bias - mean) + beta
+    auto checkFoldedConvolution = [](const Layer* const layer) -> bool
+    {
+        if (!IsLayerOfType<Convolution2dLayer>(layer))
+        {
+            return false;
+        }
+        auto convolution = static_cast<const Convolution2dLayer*>(layer);
+        const float* weights = convolution->m_Weight->GetConstTensor<float>();
+        const float* bias    = convolution->m_Bias->GetConstTensor<float>();
+        return layer->GetNameStr() == "folded-batchNorm-into-conv" &&
+               convolution->GetParameters().m_BiasEnabled &&
+               std::vector<float>(weights, weights + 4) == std::vector<float>({ 1.5f, 3.0f, 6.0f, -2.0f }) &&
+               std::vector<float>(bias, bias + 2) == std::vector<float>({ 0.25f, -3.0f });
+    };
+
+    BOOST_TEST(CheckSequence(graph.cbegin(), graph.cend(), &IsLayerOfType<InputLayer>, checkFoldedConvolution,
+                             &IsLayerOfType<OutputLayer>));
+
+    std::list<std::string> testRelatedLayers = { "batchNorm", "conv" };
+    BOOST_TEST(CheckRelatedLayers<Convolution2dLayer>(graph, testRelatedLayers));
+}
+
+BOOST_AUTO_TEST_CASE(FoldBatchNormIntoConvolution2dNotAppliedWhenConvolutionHasOtherOutputs)
+{
+    INetworkPtr network = CreateTestNetwork(false);
+    Graph graph         = static_cast<Network*>(network.get())->GetGraph();
+
+    // The convolution also feeds a second output, so folding the batch normalization would not remove it.
+    Layer* convolution = nullptr;
+    for (auto&& layer : graph)
+    {
+        if (layer->GetType() == LayerType::Convolution2d)
+        {
+            convolution = layer;
+        }
+    }
+    Layer* secondOutput = graph.AddLayer<OutputLayer>(1, "secondOutput");
+    convolution->GetOutputSlot(0).Connect(secondOutput->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, MakeOptimizations(FoldBatchNormIntoConvolution2d()));
+
+    BOOST_TEST(CheckSequence(graph.cbegin(), graph.cend(), &IsLayerOfType<InputLayer>,
+                             &IsLayerOfType<Convolution2dLayer>, &IsLayerOfType<BatchNormalizationLayer>,
+                             &IsLayerOfType<OutputLayer>, &IsLayerOfType<OutputLayer>));
+}
+
+// This unit test needs the reference backend, it's not available if the reference backend is not built
+#if defined(ARMNNREF_ENABLED)
+
+BOOST_AUTO_TEST_CASE(FoldBatchNormIntoConvolution2dCorrectnessTest)
+{
+    // The pixels (1, 2) and (3, 4) give the convolution outputs (5.5, 0.5) and (11.5, 4.5).
+    std::vector<float> expectedOutput{ 7.75f, -1.0f, 16.75f, 7.0f };
+    BOOST_TEST(RunFoldedNetwork(false) == expectedOutput, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(FoldBatchNormIntoDepthwiseConvolution2dCorrectnessTest)
+{
+    // Output channel 2 * c + m is input channel c times the weight [m, c], so the pixels (1, 2) and (3, 4) give the
+    // convolution outputs (1, 3, 4, 8) and (3, 9, 8, 16).
+    std::vector<float> expectedOutput{ 1.0f, 6.0f, 12.0f, 33.0f, 3.0f, 18.0f, 24.0f, 65.0f };
+    BOOST_TEST(RunFoldedNetwork(true) == expectedOutput, boost::test_tools::per_element());
+}
+
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,230 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "../TestUtils.hpp"
+
+#include <Network.hpp>
+#include <Optimizer.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace armnn;
+
+BOOST_AUTO_TEST_SUITE(Optimizer)
+using namespace armnn::optimizations;
+
+namespace
+{
+
+/// Input (NHWC, 1x1x2x2) -> 1x1 convolution with two output channels -> ReLu -> output.
+INetworkPtr CreateConvolutionReLuNetwork()
+{
+    INetworkPtr network = INetwork::Create();
+
+    auto input = network->AddInputLayer(0, "input");
+    input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 1, 2, 2 }, DataType::Float32));
+
+    Convolution2dDescriptor convolutionDescriptor;
+    convolutionDescriptor.m_DataLayout = DataLayout::NHWC;
+    convolutionDescriptor.m_BiasEnabled = true;
+
+    std::vector<float> weightsData{ 1.0f, 2.0f, 3.0f, -1.0f };
+    std::vector<float> biasData{ 0.5f, -3.5f };
+    ConstTensor weights(TensorInfo({ 2, 1, 1, 2 }, DataType::Float32), weightsData);
+    ConstTensor bias(TensorInfo({ 2 }, DataType::Float32), biasData);
+    auto convolution =
+        network->AddConvolution2dLayer(convolutionDescriptor, weights, Optional<ConstTensor>(bias), "conv");
+
+    const TensorInfo outputInfo({ 1, 1, 2, 2 }, DataType::Float32);
+    convolution->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    input->GetOutputSlot(0).Connect(convolution->GetInputSlot(0));
+
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::ReLu;
+    auto activation = network->AddActivationLayer(activationDescriptor, "relu");
+    activation->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    convolution->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+
+    auto output = network->AddOutputLayer(0, "output");
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    return network;
+}
+
+/// Input (QAsymm8, 1x2) -> fully connected with three outputs and no bias -> BoundedReLu(6, 0) -> output.
+INetworkPtr CreateQuantizedFullyConnectedBoundedReLuNetwork()
+{
+    INetworkPtr network = INetwork::Create();
+
+    auto input = network->AddInputLayer(0, "input");
+    input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 2 }, DataType::QuantisedAsymm8, 0.5f, 0));
+
+    FullyConnectedDescriptor fullyConnectedDescriptor;
+    fullyConnectedDescriptor.m_BiasEnabled = false;
+
+    // The weights are ((1, -1, 2), (1, -2, 1)).
+    std::vector<uint8_t> weightsData{ 130, 126, 132, 130, 124, 130 };
+    ConstTensor weights(TensorInfo({ 2, 3 }, DataType::QuantisedAsymm8, 0.5f, 128), weightsData);
+    auto fullyConnected =
+        network->AddFullyConnectedLayer(fullyConnectedDescriptor, weights, EmptyOptional(), "fullyConnected");
+
+    const TensorInfo outputInfo({ 1, 3 }, DataType::QuantisedAsymm8, 0.5f, 10);
+    fullyConnected->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    input->GetOutputSlot(0).Connect(fullyConnected->GetInputSlot(0));
+
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::BoundedReLu;
+    activationDescriptor.m_A = 6.0f;
+    activationDescriptor.m_B = 0.0f;
+    auto activation = network->AddActivationLayer(activationDescriptor, "relu6");
+    activation->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    fullyConnected->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+
+    auto output = network->AddOutputLayer(0, "output");
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    return network;
+}
+
+Graph CreateAssignedGraph(const INetwork& network, const BackendId& backendId)
+{
+    Graph graph = static_cast<const Network*>(&network)->GetGraph();
+    for (auto&& layer : graph)
+    {
+        layer->SetBackendId(backendId);
+    }
+    return graph;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(FuseActivationIntoConvolution2dOptimizerTest)
+{
+    INetworkPtr network = CreateConvolutionReLuNetwork();
+    Graph graph = CreateAssignedGraph(*network, Compute::CpuRef);
+
+    BOOST_TEST(CheckSequence(graph.cbegin(), graph.cend(), &IsLayerOfType<InputLayer>,
+                             &IsLayerOfType<Convolution2dLayer>, &IsLayerOfType<ActivationLayer>,
+                             &IsLayerOfType<OutputLayer>));
+
+    armnn::Optimizer::Pass(graph, MakeOptimizations(FuseActivationIntoConvolution2d(BackendIdSet{ Compute::CpuRef })));
+
+    auto checkFusedConvolution = [](const Layer* const layer) -> bool
+    {
+        if (!IsLayerOfType<Convolution2dLayer>(layer))
+        {
+            return false;
+        }
+        auto convolution = static_cast<const Convolution2dLayer*>(layer);
+        return layer->GetNameStr() == "fused-relu-into-conv" &&
+               layer->GetBackendId() == Compute::CpuRef &&
+               convolution->m_Weight != nullptr &&
+               convolution->m_Bias != nullptr &&
+               convolution->m_FusedActivation.has_value() &&
+               convolution->m_FusedActivation.value().m_Function == ActivationFunction::ReLu;
+    };
+
+    BOOST_TEST(CheckSequence(graph.cbegin(), graph.cend(), &IsLayerOfType<InputLayer>, checkFusedConvolution,
+                             &IsLayerOfType<OutputLayer>));
+
+    std::list<std::string> testRelatedLayers = { "relu", "conv" };
+    BOOST_TEST(CheckRelatedLayers<Convolution2dLayer>(graph, testRelatedLayers));
+}
+
+BOOST_AUTO_TEST_CASE(FuseActivationNotAppliedOnOtherBackends)
+{
+    INetworkPtr network = CreateConvolutionReLuNetwork();
+    Graph graph = CreateAssignedGraph(*network, Compute::CpuAcc);
+
+    // Only the backends in the set apply fused activations.
+    armnn::Optimizer::Pass(graph, MakeOptimizations(FuseActivationIntoConvolution2d(BackendIdSet{ Compute::CpuRef })));
+
+    BOOST_TEST(CheckSequence(graph.cbegin(), graph.cend(), &IsLayerOfType<InputLayer>,
+                             &IsLayerOfType<Convolution2dLayer>, &IsLayerOfType<ActivationLayer>,
+                             &IsLayerOfType<OutputLayer>));
+}
+
+BOOST_AUTO_TEST_CASE(FuseActivationNotAppliedToOtherActivations)
+{
+    INetworkPtr network = CreateConvolutionReLuNetwork();
+    Graph graph = CreateAssignedGraph(*network, Compute::CpuRef);
+
+    for (auto&& layer : graph)
+    {
+        if (layer->GetType() == LayerType::Activation)
+        {
+            ActivationDescriptor descriptor;
+            descriptor.m_Function = ActivationFunction::Sigmoid;
+            Layer* sigmoid = graph.InsertNewLayer<ActivationLayer>(layer->GetInputSlot(0), descriptor, "sigmoid");
+            sigmoid->GetOutputSlot().SetTensorInfo(layer->GetOutputSlot().GetTensorInfo());
+            sigmoid->SetBackendId(Compute::CpuRef);
+            break;
+        }
+    }
+
+    // The sigmoid sits between the convolution and the ReLu, so neither can be fused.
+    armnn::Optimizer::Pass(graph, MakeOptimizations(FuseActivationIntoConvolution2d(BackendIdSet{ Compute::CpuRef })));
+
+    BOOST_TEST(CheckSequence(graph.cbegin(), graph.cend(), &IsLayerOfType<InputLayer>,
+                             &IsLayerOfType<Convolution2dLayer>, &IsLayerOfType<ActivationLayer>,
+                             &IsLayerOfType<ActivationLayer>, &IsLayerOfType<OutputLayer>));
+}
+
+// This unit test needs the reference backend, it's not available if the reference backend is not built
+#if defined(ARMNNREF_ENABLED)
+
+BOOST_AUTO_TEST_CASE(FuseActivationIntoConvolution2dCorrectnessTest)
+{
+    INetworkPtr network = CreateConvolutionReLuNetwork();
+
+    IRuntimePtr runtime = IRuntime::Create(IRuntime::CreationOptions());
+    IOptimizedNetworkPtr optimizedNetwork = Optimize(*network, { Compute::CpuRef }, runtime->GetDeviceSpec());
+
+    const Graph& optGraph = static_cast<OptimizedNetwork*>(optimizedNetwork.get())->GetGraph();
+    BOOST_TEST(CheckSequence(optGraph.cbegin(), optGraph.cend(), &IsLayerOfType<InputLayer>,
+                             &IsLayerOfType<Convolution2dLayer>, &IsLayerOfType<OutputLayer>));
+
+    NetworkId netId;
+    runtime->LoadNetwork(netId, std::move(optimizedNetwork));
+
+    std::vector<float> inputData{ 1.0f, 2.0f, 3.0f, 4.0f };
+    std::vector<float> outputData(4);
+    InputTensors inputs{ { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData) } };
+    OutputTensors outputs{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) } };
+    runtime->EnqueueWorkload(netId, inputs, outputs);
+
+    // The convolution outputs (5.5, -2.5) and (11.5, 1.5) for the pixels (1, 2) and (3, 4).
+    std::vector<float> expectedOutput{ 5.5f, 0.0f, 11.5f, 1.5f };
+    BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(FuseActivationIntoQuantizedFullyConnectedCorrectnessTest)
+{
+    INetworkPtr network = CreateQuantizedFullyConnectedBoundedReLuNetwork();
+
+    IRuntimePtr runtime = IRuntime::Create(IRuntime::CreationOptions());
+    IOptimizedNetworkPtr optimizedNetwork = Optimize(*network, { Compute::CpuRef }, runtime->GetDeviceSpec());
+
+    const Graph& optGraph = static_cast<OptimizedNetwork*>(optimizedNetwork.get())->GetGraph();
+    BOOST_TEST(CheckSequence(optGraph.cbegin(), optGraph.cend(), &IsLayerOfType<InputLayer>,
+                             &IsLayerOfType<FullyConnectedLayer>, &IsLayerOfType<OutputLayer>));
+
+    NetworkId netId;
+    runtime->LoadNetwork(netId, std::move(optimizedNetwork));
+
+    // The input is (2, 4), so the fully connected layer outputs (6, -10, 8), which are clamped to [0, 6].
+    std::vector<uint8_t> inputData{ 4, 8 };
+    std::vector<uint8_t> outputData(3);
+    InputTensors inputs{ { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData) } };
+    OutputTensors outputs{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) } };
+    runtime->EnqueueWorkload(netId, inputs, outputs);
+
+    std::vector<uint8_t> expectedOutput{ 22, 10, 22 };
+    BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+}
+
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -8,6 +8,7 @@
 #include <armnn/ArmNN.hpp>
 #include <armnn/Exceptions.hpp>
 
+#include <FileMapping.hpp>
 #include <ParserHelper.hpp>
 #include <Permute.hpp>
 #include <VerificationHelpers.hpp>
@@ -25,6 +26,7 @@
 #include <fstream>
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include <numeric>
 
 using armnn::ParseException;
@@ -642,9 +644,26 @@ INetworkPtr Deserializer::CreateNetworkFromBinary(const std::vector<uint8_t>& bi
 armnn::INetworkPtr Deserializer::CreateNetworkFromBinary(std::istream& binaryContent)
 {
     ResetParser();
-    std::vector<uint8_t> content((std::istreambuf_iterator<char>(binaryContent)), std::istreambuf_iterator<char>());
-    GraphPtr graph = LoadGraphFromBinary(content.data(), content.size());
-    return CreateNetworkFromGraph(graph);
+    // The network refers to the constant tensors in the content rather than copying them again.
+    auto content = std::make_shared<std::vector<uint8_t>>((std::istreambuf_iterator<char>(binaryContent)),
+                                                          std::istreambuf_iterator<char>());
+    GraphPtr graph = LoadGraphFromBinary(content->data(), content->size());
+    return CreateNetworkFromGraph(graph, std::shared_ptr<void>(content, content->data()), content->size());
+}
+
+armnn::INetworkPtr Deserializer::CreateNetworkFromBinaryFile(const char* fileName)
+{
+    ResetParser();
+    if (fileName == nullptr)
+    {
+        throw InvalidArgumentException(boost::str(boost::format("Invalid (null) file name %1%") %
+                                                  CHECK_LOCATION().AsString()));
+    }
+
+    size_t numBytes = 0;
+    std::shared_ptr<void> content = armnnUtils::MapFile(fileName, numBytes);
+    GraphPtr graph = LoadGraphFromBinary(static_cast<const uint8_t*>(content.get()), numBytes);
+    return CreateNetworkFromGraph(graph, content, numBytes);
 }
 
 Deserializer::GraphPtr Deserializer::LoadGraphFromBinary(const uint8_t* binaryContent, size_t len)
@@ -666,10 +685,16 @@ Deserializer::GraphPtr Deserializer::LoadGraphFromBinary(const uint8_t* binaryCo
     return GetSerializedGraph(binaryContent);
 }
 
-INetworkPtr Deserializer::CreateNetworkFromGraph(GraphPtr graph)
+INetworkPtr Deserializer::CreateNetworkFromGraph(GraphPtr graph, std::shared_ptr<void> sharedMemory, size_t numBytes)
 {
     m_Network = INetwork::Create();
     BOOST_ASSERT(graph != nullptr);
+    if (sharedMemory)
+    {
+        const void* data = sharedMemory.get();
+        m_Network->ShareConstantMemory(std::move(sharedMemory), data, numBytes);
+    }
+
     unsigned int layerIndex = 0;
     for (AnyLayer const* layer : *graph->layers())
     {
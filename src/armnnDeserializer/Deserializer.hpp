@@ -9,6 +9,7 @@
 #include "armnnDeserializer/IDeserializer.hpp"
 #include <ArmnnSchema_generated.h>
 
+#include <memory>
 #include <unordered_map>
 
 namespace armnnDeserializer
@@ -38,6 +39,9 @@ public:
     /// Create an input network from a binary input stream
     armnn::INetworkPtr CreateNetworkFromBinary(std::istream& binaryContent) override;
 
+    /// Create an input network from a memory-mapped binary file
+    armnn::INetworkPtr CreateNetworkFromBinaryFile(const char* fileName) override;
+
     /// Retrieve binding info (layer id and tensor info) for the network input identified by the given layer name
     BindingPointInfo GetNetworkInputBindingInfo(unsigned int layerId, const std::string& name) const override;
 
@@ -70,8 +74,11 @@ private:
     Deserializer(const Deserializer&) = delete;
     Deserializer& operator=(const Deserializer&) = delete;
 
-    /// Create the network from an already loaded flatbuffers graph
-    armnn::INetworkPtr CreateNetworkFromGraph(GraphPtr graph);
+    /// Create the network from an already loaded flatbuffers graph. If the graph lies in sharedMemory, which is
+    /// numBytes long, the constant tensors of the network refer to it instead of copying it.
+    armnn::INetworkPtr CreateNetworkFromGraph(GraphPtr graph,
+                                              std::shared_ptr<void> sharedMemory = nullptr,
+                                              size_t numBytes = 0);
 
     // signature for the parser functions
     using LayerParsingFunction = void(Deserializer::*)(GraphPtr graph, unsigned int layerIndex);
@@ -9,9 +9,11 @@
 #include <armnn/INetwork.hpp>
 #include <armnnDeserializer/IDeserializer.hpp>
 
+#include <fstream>
 #include <random>
 #include <vector>
 
+#include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
 
 using armnnDeserializer::IDeserializer;
@@ -552,6 +554,21 @@ BOOST_AUTO_TEST_CASE(SerializeConstant)
 
     ConstantLayerVerifier verifier(layerName, {}, {info}, constTensor);
     deserializedNetwork->Accept(verifier);
+
+    // A network loaded from a file refers to the constants in the mapped file, which stays mapped after the file is
+    // removed.
+    const boost::filesystem::path fileName = boost::filesystem::temp_directory_path() /
+                                             boost::filesystem::unique_path("%%%%-%%%%-%%%%.armnn");
+    {
+        std::ofstream file(fileName.string(), std::ios::binary);
+        file << SerializeNetwork(*network);
+    }
+    armnn::INetworkPtr networkFromFile =
+        IDeserializer::Create()->CreateNetworkFromBinaryFile(fileName.string().c_str());
+    boost::filesystem::remove(fileName);
+    BOOST_CHECK(networkFromFile);
+
+    networkFromFile->Accept(verifier);
 }
 
 BOOST_AUTO_TEST_CASE(SerializeConvolution2d)
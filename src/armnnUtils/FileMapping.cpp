@@ -0,0 +1,92 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "FileMapping.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/format.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+namespace armnnUtils
+{
+
+namespace
+{
+
+// Closes the file descriptor when going out of scope, on the error paths as well.
+class ScopedFileDescriptor
+{
+public:
+    explicit ScopedFileDescriptor(int fileDescriptor) : m_FileDescriptor(fileDescriptor) {}
+    ~ScopedFileDescriptor()
+    {
+        if (m_FileDescriptor >= 0)
+        {
+            close(m_FileDescriptor);
+        }
+    }
+
+    ScopedFileDescriptor(const ScopedFileDescriptor&) = delete;
+    ScopedFileDescriptor& operator=(const ScopedFileDescriptor&) = delete;
+
+    int Get() const { return m_FileDescriptor; }
+
+private:
+    int m_FileDescriptor;
+};
+
+} // anonymous namespace
+
+std::shared_ptr<void> MapFile(const std::string& fileName, size_t& numBytes)
+{
+    const ScopedFileDescriptor file(open(fileName.c_str(), O_RDONLY | O_CLOEXEC));
+    if (file.Get() < 0)
+    {
+        throw armnn::FileNotFoundException(boost::str(boost::format("Cannot open the file %1%: %2% %3%") %
+                                                      fileName %
+                                                      std::strerror(errno) %
+                                                      CHECK_LOCATION().AsString()));
+    }
+
+    struct stat fileStatus;
+    if (fstat(file.Get(), &fileStatus) != 0)
+    {
+        throw armnn::RuntimeException(boost::str(boost::format("Cannot read the size of the file %1%: %2% %3%") %
+                                                 fileName %
+                                                 std::strerror(errno) %
+                                                 CHECK_LOCATION().AsString()));
+    }
+    if (fileStatus.st_size <= 0)
+    {
+        throw armnn::RuntimeException(boost::str(boost::format("Cannot map the empty file %1% %2%") %
+                                                 fileName %
+                                                 CHECK_LOCATION().AsString()));
+    }
+    const size_t fileSize = boost::numeric_cast<size_t>(fileStatus.st_size);
+
+    void* data = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, file.Get(), 0);
+    if (data == MAP_FAILED)
+    {
+        throw armnn::RuntimeException(boost::str(boost::format("Cannot map the file %1%: %2% %3%") %
+                                                 fileName %
+                                                 std::strerror(errno) %
+                                                 CHECK_LOCATION().AsString()));
+    }
+
+    // The mapping doesn't need the file descriptor, which is closed on return.
+    numBytes = fileSize;
+    return std::shared_ptr<void>(data, [fileSize](void* mappedData) { munmap(mappedData, fileSize); });
+}
+
+} // namespace armnnUtils
@@ -0,0 +1,21 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace armnnUtils
+{
+
+/// Maps the contents of a file into memory, read-only. The mapping is private, so its pages are shared with the page
+/// cache, and with the other processes mapping the same file, instead of being copied. The file stays mapped as long
+/// as a copy of the returned pointer is alive, and numBytes is set to its size.
+/// Throws armnn::FileNotFoundException if the file can't be opened and armnn::RuntimeException if it is empty or
+/// can't be mapped.
+std::shared_ptr<void> MapFile(const std::string& fileName, size_t& numBytes);
+
+} // namespace armnnUtils
@@ -0,0 +1,56 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <FileMapping.hpp>
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+#include <fstream>
+
+using namespace armnnUtils;
+
+BOOST_AUTO_TEST_SUITE(FileMappingSuite)
+
+BOOST_AUTO_TEST_CASE(MapFileMapsTheContentsOfTheFile)
+{
+    const boost::filesystem::path path = boost::filesystem::temp_directory_path() /
+                                         boost::filesystem::unique_path("%%%%-%%%%-%%%%.bin");
+    const std::string contents = "Arm NN file mapping";
+    {
+        std::ofstream file(path.string(), std::ios::binary);
+        file << contents;
+    }
+
+    size_t numBytes = 0;
+    std::shared_ptr<void> data = MapFile(path.string(), numBytes);
+
+    // The mapping outlives the file.
+    boost::filesystem::remove(path);
+
+    BOOST_TEST(numBytes == contents.size());
+    BOOST_TEST(std::memcmp(data.get(), contents.data(), contents.size()) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(MapFileThrowsForMissingOrEmptyFiles)
+{
+    const boost::filesystem::path path = boost::filesystem::temp_directory_path() /
+                                         boost::filesystem::unique_path("%%%%-%%%%-%%%%.bin");
+
+    size_t numBytes = 0;
+    BOOST_CHECK_THROW(MapFile(path.string(), numBytes), armnn::FileNotFoundException);
+
+    std::ofstream(path.string()).close();
+    BOOST_CHECK_THROW(MapFile(path.string(), numBytes), armnn::RuntimeException);
+    boost::filesystem::remove(path);
+
+    BOOST_CHECK_THROW(MapFile(boost::filesystem::temp_directory_path().string(), numBytes), armnn::RuntimeException);
+    BOOST_TEST(numBytes == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
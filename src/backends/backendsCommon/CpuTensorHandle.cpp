@@ -48,7 +48,7 @@ CpuTensorHandle::CpuTensorHandle(const TensorInfo& tensorInfo)
 template <>
 void* CpuTensorHandle::GetTensor<void>() const
 {
-    return m_MutableMemory;
+    return GetMutableMemory();
 }
 
 ScopedCpuTensorHandle::ScopedCpuTensorHandle(const TensorInfo& tensorInfo)
@@ -68,6 +68,14 @@ ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ConstCpuTensorHandle& tensorH
     CopyFrom(tensorHandle.GetConstTensor<void>(), tensorHandle.GetTensorInfo().GetNumBytes());
 }
 
+ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ConstTensor& tensor, std::shared_ptr<void> sharedMemory)
+: ScopedCpuTensorHandle(tensor.GetInfo())
+{
+    BOOST_ASSERT(sharedMemory);
+    m_SharedMemory = std::move(sharedMemory);
+    SetMemory(const_cast<void*>(tensor.GetMemoryArea()));
+}
+
 ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ScopedCpuTensorHandle& other)
 : CpuTensorHandle(other.GetTensorInfo())
 {
@@ -76,20 +84,19 @@ ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ScopedCpuTensorHandle& other)
 
 ScopedCpuTensorHandle& ScopedCpuTensorHandle::operator=(const ScopedCpuTensorHandle& other)
 {
-    ::operator delete(GetTensor<void>());
-    SetMemory(nullptr);
+    Free();
     CopyFrom(other);
     return *this;
 }
 
 ScopedCpuTensorHandle::~ScopedCpuTensorHandle()
 {
-    ::operator delete(GetTensor<void>());
+    Free();
 }
 
 void ScopedCpuTensorHandle::Allocate()
 {
-    if (GetTensor<void>() == nullptr)
+    if (GetConstTensor<void>() == nullptr)
     {
         SetMemory(::operator new(GetTensorInfo().GetNumBytes()));
     }
@@ -102,7 +109,7 @@ void ScopedCpuTensorHandle::Allocate()
 
 void ScopedCpuTensorHandle::CopyOutTo(void* memory) const
 {
-    memcpy(memory, GetTensor<void>(), GetTensorInfo().GetNumBytes());
+    memcpy(memory, GetConstTensor<void>(), GetTensorInfo().GetNumBytes());
 }
 
 void ScopedCpuTensorHandle::CopyInFrom(const void* memory)
@@ -112,12 +119,20 @@ void ScopedCpuTensorHandle::CopyInFrom(const void* memory)
 
 void ScopedCpuTensorHandle::CopyFrom(const ScopedCpuTensorHandle& other)
 {
-    CopyFrom(other.GetTensor<void>(), other.GetTensorInfo().GetNumBytes());
+    if (other.m_SharedMemory)
+    {
+        BOOST_ASSERT(GetConstTensor<void>() == nullptr);
+        m_SharedMemory = other.m_SharedMemory;
+        SetMemory(const_cast<void*>(other.GetConstTensor<void>()));
+        return;
+    }
+
+    CopyFrom(other.GetConstTensor<void>(), other.GetTensorInfo().GetNumBytes());
 }
 
 void ScopedCpuTensorHandle::CopyFrom(const void* srcMemory, unsigned int numBytes)
 {
-    BOOST_ASSERT(GetTensor<void>() == nullptr);
+    BOOST_ASSERT(GetConstTensor<void>() == nullptr);
     BOOST_ASSERT(GetTensorInfo().GetNumBytes() == numBytes);
 
     if (srcMemory)
@@ -127,6 +142,38 @@ void ScopedCpuTensorHandle::CopyFrom(const void* srcMemory, unsigned int numByte
     }
 }
 
+void* ScopedCpuTensorHandle::GetMutableMemory() const
+{
+    if (m_SharedMemory)
+    {
+        // Like the allocation of the memory, this isn't safe to call concurrently on the same handle.
+        const_cast<ScopedCpuTensorHandle*>(this)->CopySharedMemory();
+    }
+    return CpuTensorHandle::GetMutableMemory();
+}
+
+void ScopedCpuTensorHandle::CopySharedMemory()
+{
+    // Keeps the shared memory alive until its contents are copied.
+    std::shared_ptr<void> sharedMemory = std::move(m_SharedMemory);
+    const void* sharedContents = GetConstTensor<void>();
+    SetMemory(nullptr);
+    CopyFrom(sharedContents, GetTensorInfo().GetNumBytes());
+}
+
+void ScopedCpuTensorHandle::Free()
+{
+    if (m_SharedMemory)
+    {
+        m_SharedMemory.reset();
+    }
+    else
+    {
+        ::operator delete(const_cast<void*>(GetConstTensor<void>()));
+    }
+    SetMemory(nullptr);
+}
+
 void PassthroughCpuTensorHandle::Allocate()
 {
     throw InvalidArgumentException("PassthroughCpuTensorHandle::Allocate() should never be called");
@@ -12,6 +12,7 @@
 #include <backendsCommon/OutputHandler.hpp>
 
 #include <algorithm>
+#include <memory>
 
 namespace armnn
 {
@@ -77,12 +78,15 @@ public:
     T* GetTensor() const
     {
         BOOST_ASSERT(CompatibleTypes<T>(GetTensorInfo().GetDataType()));
-        return reinterpret_cast<T*>(m_MutableMemory);
+        return reinterpret_cast<T*>(GetMutableMemory());
     }
 
 protected:
     CpuTensorHandle(const TensorInfo& tensorInfo);
 
+    // Returns the memory GetTensor() gives write access to.
+    virtual void* GetMutableMemory() const { return m_MutableMemory; }
+
     void SetMemory(void* mem)
     {
         m_MutableMemory = mem;
@@ -111,12 +115,22 @@ public:
     // Copies contents from ConstCpuTensorHandle
     explicit ScopedCpuTensorHandle(const ConstCpuTensorHandle& tensorHandle);
 
+    // Refers to the contents of the Tensor instead of copying them. They must lie in the memory sharedMemory keeps
+    // alive, which is shared with the copies of this handle and may be read-only. The handle copies the contents the
+    // first time GetTensor() gives write access to them, so writes never reach the shared memory.
+    ScopedCpuTensorHandle(const ConstTensor& tensor, std::shared_ptr<void> sharedMemory);
+
     ScopedCpuTensorHandle(const ScopedCpuTensorHandle& other);
     ScopedCpuTensorHandle& operator=(const ScopedCpuTensorHandle& other);
     ~ScopedCpuTensorHandle();
 
     virtual void Allocate() override;
 
+    bool IsMemoryShared() const { return m_SharedMemory != nullptr; }
+
+protected:
+    void* GetMutableMemory() const override;
+
 private:
     // Only used for testing
     void CopyOutTo(void* memory) const override;
@@ -124,6 +138,10 @@ private:
 
     void CopyFrom(const ScopedCpuTensorHandle& other);
     void CopyFrom(const void* srcMemory, unsigned int numBytes);
+    void CopySharedMemory();
+    void Free();
+
+    std::shared_ptr<void> m_SharedMemory;
 };
 
 // A CpuTensorHandle that wraps an already allocated memory region.
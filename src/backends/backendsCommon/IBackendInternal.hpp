@@ -113,6 +113,10 @@ public:
 
     virtual IBackendContextPtr CreateBackendContext(const IRuntime::CreationOptions&) const;
 
+    /// (Optional) Called with the context returned by CreateBackendContext() to the runtime loading a network on the
+    /// backend, before the workload factories of the network are created.
+    virtual void SetBackendContext(IBackendContext& backendContext) {}
+
     virtual ILayerSupportSharedPtr GetLayerSupport() const = 0;
 
     virtual OptimizationViews OptimizeSubgraphView(const SubgraphView& subgraph) const;
@@ -129,6 +133,10 @@ public:
     /// IWorkloadFactory::CreateTensor()/IWorkloadFactory::CreateSubtensor() methods must be implemented.
     virtual void RegisterTensorHandleFactories(class TensorHandleFactoryRegistry& registry) {}
 
+    /// (Optional) Returns true if the workloads created by this backend run on the tensor handles passed to
+    /// IWorkload::ExecuteAsync(), allowing a network to be executed concurrently with separate working memory.
+    virtual bool SupportsAsyncExecution() const { return false; }
+
     /// Returns the version of the Backend API
     static constexpr BackendVersion GetApiVersion() { return BackendVersion(1, 0); }
 };
@@ -4,6 +4,7 @@
 //
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 namespace armnn
@@ -15,6 +16,17 @@ protected:
     IMemoryManager() {}
 
 public:
+    /// Called once the lifetimes of all the tensors the memory manager manages are known, before memory is first
+    /// acquired, so that the memory can be laid out ahead of execution.
+    virtual void PlanMemory() {}
+
+    /// The memory laid out for the managed tensors by PlanMemory(), in bytes, or 0 if the memory manager doesn't
+    /// plan its memory ahead of execution.
+    virtual size_t GetPlannedBytes() const { return 0; }
+
+    /// The memory the managed tensors would take if none of them shared it, in bytes, or 0 if unknown.
+    virtual size_t GetManagedBytes() const { return 0; }
+
     virtual void Acquire() = 0;
     virtual void Release() = 0;
 
@@ -9,6 +9,7 @@
 
 #include <ResolveType.hpp>
 
+#include <boost/assert.hpp>
 #include <boost/cast.hpp>
 
 #include <cstring>
@@ -62,4 +63,20 @@ void CopyMemGenericWorkload::Execute() const
     }
 }
 
+void CopyMemGenericWorkload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "CopyMemGeneric_Execute_WorkingMemDescriptor");
+
+    auto copyFunc = [](void* dst, const void* src, size_t size)
+        {
+            memcpy(dst, src, size);
+        };
+
+    BOOST_ASSERT(workingMemDescriptor.m_Inputs.size() == workingMemDescriptor.m_Outputs.size());
+    for (unsigned int i = 0; i < workingMemDescriptor.m_Inputs.size(); ++i)
+    {
+        CopyTensorContentsGeneric(workingMemDescriptor.m_Inputs[i], workingMemDescriptor.m_Outputs[i], copyFunc);
+    }
+}
+
 } //namespace armnn
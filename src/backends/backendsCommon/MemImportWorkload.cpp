@@ -31,4 +31,20 @@ void ImportMemGenericWorkload::Execute() const
     m_TensorHandlePairs.first->Unmap();
 }
 
+void ImportMemGenericWorkload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "ImportMemGeneric_Execute_WorkingMemDescriptor");
+
+    ITensorHandle* const srcTensorHandle = workingMemDescriptor.m_Inputs[0];
+    ITensorHandle* const dstTensorHandle = workingMemDescriptor.m_Outputs[0];
+
+    const bool imported = dstTensorHandle->Import(const_cast<void*>(srcTensorHandle->Map(true)),
+                                                  MemorySource::Malloc);
+    srcTensorHandle->Unmap();
+    if (!imported)
+    {
+        throw MemoryImportException("ImportMemGenericWorkload: Memory Import failed");
+    }
+}
+
 } //namespace armnn
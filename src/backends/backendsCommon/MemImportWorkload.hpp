@@ -18,6 +18,7 @@ class ImportMemGenericWorkload : public BaseWorkload<MemImportQueueDescriptor>
 public:
     ImportMemGenericWorkload(const MemImportQueueDescriptor& descriptor, const WorkloadInfo& info);
     void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
 
 private:
     using TensorHandlePair = std::pair<const ITensorHandle*, ITensorHandle*>;
@@ -50,6 +50,14 @@ ITensorHandleFactory* TensorHandleFactoryRegistry::GetFactory(ITensorHandleFacto
     return nullptr;
 }
 
+void TensorHandleFactoryRegistry::PlanMemory()
+{
+    for (auto& mgr : m_MemoryManagers)
+    {
+        mgr->PlanMemory();
+    }
+}
+
 void TensorHandleFactoryRegistry::AquireMemory()
 {
     for (auto& mgr : m_MemoryManagers)
@@ -66,4 +74,24 @@ void TensorHandleFactoryRegistry::ReleaseMemory()
     }
 }
 
+size_t TensorHandleFactoryRegistry::GetPlannedBytes() const
+{
+    size_t plannedBytes = 0;
+    for (auto& mgr : m_MemoryManagers)
+    {
+        plannedBytes += mgr->GetPlannedBytes();
+    }
+    return plannedBytes;
+}
+
+size_t TensorHandleFactoryRegistry::GetManagedBytes() const
+{
+    size_t managedBytes = 0;
+    for (auto& mgr : m_MemoryManagers)
+    {
+        managedBytes += mgr->GetManagedBytes();
+    }
+    return managedBytes;
+}
+
 } // namespace armnn
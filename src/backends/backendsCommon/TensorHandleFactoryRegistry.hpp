@@ -35,12 +35,21 @@ public:
     /// Returns nullptr if not found
     ITensorHandleFactory* GetFactory(ITensorHandleFactory::FactoryId id) const;
 
+    /// Lay out the memory required for inference once all tensor handles are allocated
+    void PlanMemory();
+
     /// Aquire memory required for inference
     void AquireMemory();
 
     /// Release memory required for inference
     void ReleaseMemory();
 
+    /// The memory laid out by the registered memory managers, in bytes
+    size_t GetPlannedBytes() const;
+
+    /// The memory the tensors of the registered memory managers would take without sharing, in bytes
+    size_t GetManagedBytes() const;
+
 private:
     std::vector<std::unique_ptr<ITensorHandleFactory>> m_Factories;
     std::vector<std::shared_ptr<IMemoryManager>> m_MemoryManagers;
@@ -0,0 +1,25 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <backendsCommon/ITensorHandle.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+/// Tensor handles a workload reads from and writes to during one execution.
+/// Used in place of the handles stored in the workload's queue descriptor, so that several
+/// executions of the same workload can run concurrently, each on its own working memory.
+struct WorkingMemDescriptor
+{
+    std::vector<ITensorHandle*> m_Inputs;
+    std::vector<ITensorHandle*> m_Outputs;
+
+    ~WorkingMemDescriptor() = default;
+};
+
+} //namespace armnn
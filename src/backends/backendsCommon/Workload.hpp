@@ -4,13 +4,17 @@
 //
 #pragma once
 
+#include "WorkingMemDescriptor.hpp"
 #include "WorkloadData.hpp"
 #include "WorkloadInfo.hpp"
 
+#include <armnn/Exceptions.hpp>
 #include <armnn/Types.hpp>
 #include <Profiling.hpp>
 #include <ProfilingService.hpp>
 
+#include <boost/core/ignore_unused.hpp>
+
 #include <algorithm>
 
 namespace armnn
@@ -25,6 +29,10 @@ public:
     virtual void PostAllocationConfigure() = 0;
     virtual void Execute() const = 0;
 
+    /// Executes the workload on the tensor handles in workingMemDescriptor rather than on the ones
+    /// it was created with. Different descriptors can be executed concurrently from different threads.
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) = 0;
+
     virtual profiling::ProfilingGuid GetGuid() const = 0;
 
     virtual void RegisterDebugCallback(const DebugCallbackFunction& func) {}
@@ -52,12 +60,20 @@ public:
 
     void PostAllocationConfigure() override {}
 
+    /// The workloads of backends which support asynchronous execution override this to run on the tensor handles
+    /// of workingMemDescriptor. The others are never given separate working memory.
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override
+    {
+        boost::ignore_unused(workingMemDescriptor);
+        throw UnimplementedException("This workload can't be executed on separate working memory");
+    }
+
     const QueueDescriptor& GetData() const { return m_Data; }
 
     profiling::ProfilingGuid GetGuid() const final { return m_Guid; }
 
 protected:
-    const QueueDescriptor m_Data;
+    QueueDescriptor m_Data;
     const profiling::ProfilingGuid m_Guid;
 };
 
@@ -4,6 +4,7 @@
 //
 
 #include "RefBackend.hpp"
+#include "RefBackendContext.hpp"
 #include "RefBackendId.hpp"
 #include "RefWorkloadFactory.hpp"
 #include "RefLayerSupport.hpp"
@@ -22,6 +23,11 @@
 namespace armnn
 {
 
+RefBackend::RefBackend()
+    : m_ThreadPool(std::make_shared<RefThreadPool>())
+{
+}
+
 const BackendId& RefBackend::GetIdStatic()
 {
     static const BackendId s_Id{RefBackendId()};
@@ -31,7 +37,8 @@ const BackendId& RefBackend::GetIdStatic()
 IBackendInternal::IWorkloadFactoryPtr RefBackend::CreateWorkloadFactory(
     const IBackendInternal::IMemoryManagerSharedPtr& memoryManager) const
 {
-    return std::make_unique<RefWorkloadFactory>(boost::polymorphic_pointer_downcast<RefMemoryManager>(memoryManager));
+    return std::make_unique<RefWorkloadFactory>(boost::polymorphic_pointer_downcast<RefMemoryManager>(memoryManager),
+                                                m_ThreadPool);
 }
 
 IBackendInternal::IWorkloadFactoryPtr RefBackend::CreateWorkloadFactory(
@@ -41,12 +48,18 @@ IBackendInternal::IWorkloadFactoryPtr RefBackend::CreateWorkloadFactory(
 
     tensorHandleFactoryRegistry.RegisterMemoryManager(memoryManager);
 
-    return std::make_unique<RefWorkloadFactory>(boost::polymorphic_pointer_downcast<RefMemoryManager>(memoryManager));
+    return std::make_unique<RefWorkloadFactory>(boost::polymorphic_pointer_downcast<RefMemoryManager>(memoryManager),
+                                                m_ThreadPool);
+}
+
+IBackendInternal::IBackendContextPtr RefBackend::CreateBackendContext(const IRuntime::CreationOptions& options) const
+{
+    return IBackendContextPtr{new RefBackendContext{options}};
 }
 
-IBackendInternal::IBackendContextPtr RefBackend::CreateBackendContext(const IRuntime::CreationOptions&) const
+void RefBackend::SetBackendContext(IBackendContext& backendContext)
 {
-    return IBackendContextPtr{};
+    m_ThreadPool = boost::polymorphic_downcast<RefBackendContext*>(&backendContext)->GetThreadPool();
 }
 
 IBackendInternal::IMemoryManagerUniquePtr RefBackend::CreateMemoryManager() const
@@ -4,6 +4,8 @@
 //
 #pragma once
 
+#include "workloads/RefThreadPool.hpp"
+
 #include <backendsCommon/IBackendInternal.hpp>
 
 namespace armnn
@@ -12,7 +14,7 @@ namespace armnn
 class RefBackend : public IBackendInternal
 {
 public:
-    RefBackend()  = default;
+    RefBackend();
     ~RefBackend() = default;
 
     static const BackendId& GetIdStatic();
@@ -28,6 +30,8 @@ public:
 
     IBackendInternal::IBackendContextPtr CreateBackendContext(const IRuntime::CreationOptions&) const override;
 
+    void SetBackendContext(IBackendContext& backendContext) override;
+
     IBackendInternal::Optimizations GetOptimizations() const override;
     IBackendInternal::ILayerSupportSharedPtr GetLayerSupport() const override;
 
@@ -36,6 +40,13 @@ public:
     std::vector<ITensorHandleFactory::FactoryId> GetHandleFactoryPreferences() const override;
 
     void RegisterTensorHandleFactories(class TensorHandleFactoryRegistry& registry) override;
+
+    bool SupportsAsyncExecution() const override { return true; }
+
+private:
+    // The pool of the runtime loading the network, or one running the workloads on the calling thread if the
+    // backend is used without a runtime.
+    std::shared_ptr<RefThreadPool> m_ThreadPool;
 };
 
 } // namespace armnn
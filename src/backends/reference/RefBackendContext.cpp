@@ -0,0 +1,37 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "RefBackendContext.hpp"
+
+namespace armnn
+{
+
+RefBackendContext::RefBackendContext(const IRuntime::CreationOptions& options)
+    : IBackendContext(options)
+    , m_ThreadPool(std::make_shared<RefThreadPool>(options.m_CpuRefNumThreads))
+{
+}
+
+bool RefBackendContext::BeforeLoadNetwork(NetworkId)
+{
+    return true;
+}
+
+bool RefBackendContext::AfterLoadNetwork(NetworkId)
+{
+    return true;
+}
+
+bool RefBackendContext::BeforeUnloadNetwork(NetworkId)
+{
+    return true;
+}
+
+bool RefBackendContext::AfterUnloadNetwork(NetworkId)
+{
+    return true;
+}
+
+} // namespace armnn
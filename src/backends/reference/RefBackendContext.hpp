@@ -0,0 +1,34 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "workloads/RefThreadPool.hpp"
+
+#include <backendsCommon/IBackendContext.hpp>
+
+#include <memory>
+
+namespace armnn
+{
+
+/// Holds the thread pool of a runtime, which the reference workloads of the networks it loads share.
+class RefBackendContext : public IBackendContext
+{
+public:
+    RefBackendContext(const IRuntime::CreationOptions& options);
+
+    bool BeforeLoadNetwork(NetworkId networkId) override;
+    bool AfterLoadNetwork(NetworkId networkId) override;
+
+    bool BeforeUnloadNetwork(NetworkId networkId) override;
+    bool AfterUnloadNetwork(NetworkId networkId) override;
+
+    const std::shared_ptr<RefThreadPool>& GetThreadPool() const { return m_ThreadPool; }
+
+private:
+    std::shared_ptr<RefThreadPool> m_ThreadPool;
+};
+
+} // namespace armnn
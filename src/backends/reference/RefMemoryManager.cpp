@@ -5,98 +5,197 @@
 #include "RefMemoryManager.hpp"
 
 #include <boost/assert.hpp>
+#include <boost/log/trivial.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <vector>
 
 namespace armnn
 {
 
+namespace
+{
+
+// Tensors are placed at offsets aligned like the memory returned by operator new.
+size_t AlignedSize(size_t numBytes)
+{
+    constexpr size_t alignment = alignof(std::max_align_t);
+    return (numBytes + alignment - 1) / alignment * alignment;
+}
+
+} // anonymous namespace
+
 RefMemoryManager::RefMemoryManager()
+    : m_Time(0),
+      m_IsPlanned(true),
+      m_PlannedBytes(0),
+      m_ManagedBytes(0),
+      m_Arena(nullptr)
 {}
 
 RefMemoryManager::~RefMemoryManager()
-{}
-
-RefMemoryManager::Pool* RefMemoryManager::Manage(unsigned int numBytes)
 {
-    if (!m_FreePools.empty())
+    if (m_Arena)
     {
-        Pool* res = m_FreePools.back();
-        m_FreePools.pop_back();
-        res->Reserve(numBytes);
-        return res;
-    }
-    else
-    {
-        m_Pools.push_front(Pool(numBytes));
-        return &m_Pools.front();
+        Release();
     }
 }
 
+RefMemoryManager::Pool* RefMemoryManager::Manage(unsigned int numBytes)
+{
+    BOOST_ASSERT_MSG(!m_Arena, "RefMemoryManager::Manage() cannot be called after memory acquired");
+    m_Pools.emplace_front(numBytes, m_Time++);
+    m_IsPlanned = false;
+    return &m_Pools.front();
+}
+
 void RefMemoryManager::Allocate(RefMemoryManager::Pool* pool)
 {
     BOOST_ASSERT(pool);
-    m_FreePools.push_back(pool);
+    BOOST_ASSERT_MSG(!m_Arena, "RefMemoryManager::Allocate() cannot be called after memory acquired");
+    pool->m_LastUse = m_Time++;
+    m_IsPlanned = false;
 }
 
 void* RefMemoryManager::GetPointer(RefMemoryManager::Pool* pool)
 {
-    return pool->GetPointer();
+    BOOST_ASSERT_MSG(m_Arena, "RefMemoryManager::GetPointer() called when memory not acquired");
+    return static_cast<char*>(m_Arena) + pool->m_Offset;
 }
 
-void RefMemoryManager::Acquire()
+void RefMemoryManager::PlanMemory()
 {
-    for (Pool &pool: m_Pools)
+    BOOST_ASSERT_MSG(!m_Arena, "RefMemoryManager::PlanMemory() cannot be called after memory acquired");
+    if (m_IsPlanned)
     {
-         pool.Acquire();
+        return;
     }
-}
 
-void RefMemoryManager::Release()
-{
-    for (Pool &pool: m_Pools)
+    // Replays the lifetimes in the order they start and end. Tensors which are never freed have no end.
+    struct LifetimeEvent
     {
-         pool.Release();
-    }
-}
-
-RefMemoryManager::Pool::Pool(unsigned int numBytes)
-    : m_Size(numBytes),
-      m_Pointer(nullptr)
-{}
+        unsigned int m_Time;
+        Pool* m_Pool;
+        bool m_IsStart;
+    };
 
-RefMemoryManager::Pool::~Pool()
-{
-    if (m_Pointer)
+    std::vector<LifetimeEvent> events;
+    for (Pool& pool : m_Pools)
     {
-        Release();
+        events.push_back({ pool.m_FirstUse, &pool, true });
+        if (pool.m_LastUse != std::numeric_limits<unsigned int>::max())
+        {
+            events.push_back({ pool.m_LastUse, &pool, false });
+        }
+    }
+    std::sort(events.begin(), events.end(), [](const LifetimeEvent& lhs, const LifetimeEvent& rhs)
+    {
+        return lhs.m_Time < rhs.m_Time;
+    });
+
+    // The gaps left in the arena by the tensors which were freed, by offset, merged with their neighbours.
+    std::map<size_t, size_t> freeIntervals;
+    size_t numTensors = 0;
+    m_PlannedBytes = 0;
+    m_ManagedBytes = 0;
+    for (const LifetimeEvent& event : events)
+    {
+        Pool* pool = event.m_Pool;
+        const size_t size = AlignedSize(pool->m_Size);
+
+        if (event.m_IsStart)
+        {
+            ++numTensors;
+            m_ManagedBytes += size;
+
+            // Takes the smallest gap the tensor fits in.
+            auto bestFit = freeIntervals.end();
+            for (auto interval = freeIntervals.begin(); interval != freeIntervals.end(); ++interval)
+            {
+                if (interval->second >= size && (bestFit == freeIntervals.end() || interval->second < bestFit->second))
+                {
+                    bestFit = interval;
+                }
+            }
+
+            if (bestFit != freeIntervals.end())
+            {
+                pool->m_Offset = bestFit->first;
+                const size_t remainingSize = bestFit->second - size;
+                freeIntervals.erase(bestFit);
+                if (remainingSize > 0)
+                {
+                    freeIntervals.emplace(pool->m_Offset + size, remainingSize);
+                }
+            }
+            else
+            {
+                // Grows the arena, starting in the gap at its end if there is one.
+                pool->m_Offset = m_PlannedBytes;
+                if (!freeIntervals.empty())
+                {
+                    auto lastInterval = std::prev(freeIntervals.end());
+                    if (lastInterval->first + lastInterval->second == m_PlannedBytes)
+                    {
+                        pool->m_Offset = lastInterval->first;
+                        freeIntervals.erase(lastInterval);
+                    }
+                }
+                m_PlannedBytes = pool->m_Offset + size;
+            }
+        }
+        else
+        {
+            size_t offset = pool->m_Offset;
+            size_t end = offset + size;
+
+            auto next = freeIntervals.lower_bound(offset);
+            if (next != freeIntervals.end() && next->first == end)
+            {
+                end += next->second;
+                next = freeIntervals.erase(next);
+            }
+            if (next != freeIntervals.begin())
+            {
+                auto previous = std::prev(next);
+                if (previous->first + previous->second == offset)
+                {
+                    offset = previous->first;
+                    freeIntervals.erase(previous);
+                }
+            }
+            freeIntervals.emplace(offset, end - offset);
+        }
     }
-}
 
-void* RefMemoryManager::Pool::GetPointer()
-{
-    BOOST_ASSERT_MSG(m_Pointer, "RefMemoryManager::Pool::GetPointer() called when memory not acquired");
-    return m_Pointer;
+    m_IsPlanned = true;
+    BOOST_LOG_TRIVIAL(debug) << "RefMemoryManager: planned " << m_PlannedBytes << " bytes of working memory for "
+                             << numTensors << " tensors of " << m_ManagedBytes << " bytes in total";
 }
 
-void RefMemoryManager::Pool::Reserve(unsigned int numBytes)
+void RefMemoryManager::Acquire()
 {
-    BOOST_ASSERT_MSG(!m_Pointer, "RefMemoryManager::Pool::Reserve() cannot be called after memory acquired");
-    m_Size = std::max(m_Size, numBytes);
+    BOOST_ASSERT_MSG(!m_Arena, "RefMemoryManager::Acquire() called when memory already acquired");
+    PlanMemory();
+    m_Arena = ::operator new(m_PlannedBytes);
 }
 
-void RefMemoryManager::Pool::Acquire()
+void RefMemoryManager::Release()
 {
-    BOOST_ASSERT_MSG(!m_Pointer, "RefMemoryManager::Pool::Acquire() called when memory already acquired");
-    BOOST_ASSERT(m_Size >= 0);
-    m_Pointer = ::operator new(size_t(m_Size));
+    BOOST_ASSERT_MSG(m_Arena, "RefMemoryManager::Release() called when memory not acquired");
+    ::operator delete(m_Arena);
+    m_Arena = nullptr;
 }
 
-void RefMemoryManager::Pool::Release()
-{
-    BOOST_ASSERT_MSG(m_Pointer, "RefMemoryManager::Pool::Release() called when memory not acquired");
-    ::operator delete(m_Pointer);
-    m_Pointer = nullptr;
-}
+RefMemoryManager::Pool::Pool(unsigned int numBytes, unsigned int firstUse)
+    : m_Size(numBytes),
+      m_Offset(0),
+      m_FirstUse(firstUse),
+      m_LastUse(std::numeric_limits<unsigned int>::max())
+{}
 
 }
@@ -6,13 +6,21 @@
 
 #include <backendsCommon/IMemoryManager.hpp>
 
+#include <cstddef>
 #include <forward_list>
-#include <vector>
 
 namespace armnn
 {
 
-// An implementation of IMemoryManager to be used with RefTensorHandle
+// An implementation of IMemoryManager to be used with RefTensorHandle.
+//
+// The tensor handles announce the start of a tensor's lifetime with Manage() and its end with Allocate(), in the
+// order the layers are executed. Once all lifetimes are known, PlanMemory() packs the tensors into a single arena,
+// giving tensors whose lifetimes don't overlap the same bytes, so that the working memory of a network is close to
+// the largest set of tensors alive at the same time rather than the sum of all of them.
+//
+// The plan replays the lifetimes in order, placing each tensor in the smallest gap left by the tensors freed before
+// it starts, which takes O(n log n) plus the scan of the gaps for each tensor.
 class RefMemoryManager : public IMemoryManager
 {
 public:
@@ -21,39 +29,55 @@ public:
 
     class Pool;
 
+    /// Starts the lifetime of a tensor of numBytes bytes.
     Pool* Manage(unsigned int numBytes);
 
+    /// Ends the lifetime of the tensor. Tensors whose lifetime is never ended live until the end of execution.
     void Allocate(Pool *pool);
 
     void* GetPointer(Pool *pool);
 
+    /// Assigns each managed tensor an offset in the arena. Called by Acquire() if tensors were managed since the
+    /// last plan.
+    void PlanMemory() override;
+
     void Acquire() override;
     void Release() override;
 
+    /// The size of the arena, i.e. the working memory needed by the managed tensors.
+    size_t GetPlannedBytes() const override { return m_PlannedBytes; }
+
+    /// The working memory the managed tensors would need without sharing.
+    size_t GetManagedBytes() const override { return m_ManagedBytes; }
+
+    /// The memory of one tensor in the arena.
     class Pool
     {
     public:
-        Pool(unsigned int numBytes);
-        ~Pool();
-
-        void Acquire();
-        void Release();
-
-        void* GetPointer();
-
-        void Reserve(unsigned int numBytes);
+        Pool(unsigned int numBytes, unsigned int firstUse);
 
     private:
+        friend class RefMemoryManager;
+
         unsigned int m_Size;
-        void* m_Pointer;
+        size_t m_Offset;
+        unsigned int m_FirstUse;
+        unsigned int m_LastUse;
     };
-    
+
 private:
     RefMemoryManager(const RefMemoryManager&) = delete; // Noncopyable
     RefMemoryManager& operator=(const RefMemoryManager&) = delete; // Noncopyable
 
     std::forward_list<Pool> m_Pools;
-    std::vector<Pool*> m_FreePools;
+
+    // Counts the Manage() and Allocate() calls, to order the lifetimes of the tensors.
+    unsigned int m_Time;
+
+    bool m_IsPlanned;
+    size_t m_PlannedBytes;
+    size_t m_ManagedBytes;
+    void* m_Arena;
 };
 
 }
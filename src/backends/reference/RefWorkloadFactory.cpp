@@ -57,11 +57,20 @@ bool IsQSymm16(const WorkloadInfo& info)
 
 RefWorkloadFactory::RefWorkloadFactory(const std::shared_ptr<RefMemoryManager>& memoryManager)
     : m_MemoryManager(memoryManager)
+    , m_ThreadPool(std::make_shared<RefThreadPool>())
+{
+}
+
+RefWorkloadFactory::RefWorkloadFactory(const std::shared_ptr<RefMemoryManager>& memoryManager,
+                                       const std::shared_ptr<RefThreadPool>& threadPool)
+    : m_MemoryManager(memoryManager)
+    , m_ThreadPool(threadPool)
 {
 }
 
 RefWorkloadFactory::RefWorkloadFactory()
     : m_MemoryManager(new RefMemoryManager())
+    , m_ThreadPool(std::make_shared<RefThreadPool>())
 {
 }
 
@@ -166,7 +175,7 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateConvertFp32ToFp16(
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateConvolution2d(const Convolution2dQueueDescriptor& descriptor,
                                                                    const WorkloadInfo& info) const
 {
-    return std::make_unique<RefConvolution2dWorkload>(descriptor, info);
+    return std::make_unique<RefConvolution2dWorkload>(descriptor, info, m_ThreadPool);
 }
 
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateDebug(const DebugQueueDescriptor& descriptor,
@@ -194,7 +203,7 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateDepthwiseConvolution2d(
     const DepthwiseConvolution2dQueueDescriptor& descriptor,
     const WorkloadInfo& info) const
 {
-    return std::make_unique<RefDepthwiseConvolution2dWorkload>(descriptor, info);
+    return std::make_unique<RefDepthwiseConvolution2dWorkload>(descriptor, info, m_ThreadPool);
 }
 
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateDequantize(const DequantizeQueueDescriptor& descriptor,
@@ -242,7 +251,7 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateFullyConnected(
     const FullyConnectedQueueDescriptor& descriptor,
     const WorkloadInfo& info) const
 {
-    return std::make_unique<RefFullyConnectedWorkload>(descriptor, info);
+    return std::make_unique<RefFullyConnectedWorkload>(descriptor, info, m_ThreadPool);
 }
 
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateGather(const GatherQueueDescriptor& descriptor,
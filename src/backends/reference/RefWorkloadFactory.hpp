@@ -9,6 +9,7 @@
 #include <backendsCommon/OutputHandler.hpp>
 
 #include "RefMemoryManager.hpp"
+#include "workloads/RefThreadPool.hpp"
 
 #include <boost/core/ignore_unused.hpp>
 
@@ -33,6 +34,12 @@ class RefWorkloadFactory : public IWorkloadFactory
 {
 public:
     explicit RefWorkloadFactory(const std::shared_ptr<RefMemoryManager>& memoryManager);
+
+    /// The Convolution2d, DepthwiseConvolution2d and FullyConnected workloads are split across the threads of
+    /// threadPool. The other constructors give them a pool of their own which runs them on the calling thread.
+    RefWorkloadFactory(const std::shared_ptr<RefMemoryManager>& memoryManager,
+                       const std::shared_ptr<RefThreadPool>& threadPool);
+
     RefWorkloadFactory();
 
     ~RefWorkloadFactory() {}
@@ -240,6 +247,7 @@ private:
     std::unique_ptr<IWorkload> MakeWorkload(const QueueDescriptorType& descriptor, const WorkloadInfo& info) const;
 
     mutable std::shared_ptr<RefMemoryManager> m_MemoryManager;
+    std::shared_ptr<RefThreadPool> m_ThreadPool;
 };
 
 } // namespace armnn
@@ -15,6 +15,7 @@ ifeq ($(ARMNN_REF_ENABLED),1)
 
 BACKEND_SOURCES := \
         RefBackend.cpp \
+        RefBackendContext.cpp \
         RefLayerSupport.cpp \
         RefMemoryManager.cpp \
         RefTensorHandle.cpp \
@@ -27,6 +28,7 @@ BACKEND_SOURCES := \
         workloads/BatchNormImpl.cpp \
         workloads/BatchToSpaceNd.cpp \
         workloads/Broadcast.cpp \
+        workloads/ConvGemm.cpp \
         workloads/ConvImpl.cpp \
         workloads/Debug.cpp \
         workloads/DepthToSpace.cpp \
@@ -86,6 +88,7 @@ BACKEND_SOURCES := \
         workloads/RefStackWorkload.cpp \
         workloads/RefStridedSliceWorkload.cpp \
         workloads/RefSplitterWorkload.cpp \
+        workloads/RefThreadPool.cpp \
         workloads/RefTransposeConvolution2dWorkload.cpp \
         workloads/Resize.cpp \
         workloads/Rsqrt.cpp \
@@ -118,6 +121,7 @@ ifeq ($(ARMNN_REF_ENABLED),1)
 # Include the source files for the CL backend tests
 
 BACKEND_TEST_SOURCES := \
+        test/RefConvolutionMethodTests.cpp \
         test/RefCreateWorkloadTests.cpp \
         test/RefDetectionPostProcessTests.cpp \
         test/RefEndToEndTests.cpp \
@@ -126,7 +130,9 @@ BACKEND_TEST_SOURCES := \
         test/RefLayerTests.cpp \
         test/RefMemoryManagerTests.cpp \
         test/RefOptimizedNetworkTests.cpp \
-        test/RefRuntimeTests.cpp
+        test/RefQuantizedArithmeticTests.cpp \
+        test/RefRuntimeTests.cpp \
+        test/RefTypedKernelTests.cpp
 else
 
 # ARMNN_REF_ENABLED == 0
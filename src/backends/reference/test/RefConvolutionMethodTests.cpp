@@ -0,0 +1,160 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/workloads/ConvImpl.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+
+using namespace armnn;
+
+struct ConvolutionCase
+{
+    DataType m_DataType;
+    DataLayout m_DataLayout;
+    bool m_Depthwise;
+    unsigned int m_DepthMultiplier;
+    unsigned int m_Stride;
+    unsigned int m_Dilation;
+    unsigned int m_Padding;
+    bool m_BiasEnabled;
+};
+
+template<typename T>
+std::vector<T> MakeData(unsigned int numElements, unsigned int seed)
+{
+    std::vector<T> data(numElements);
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        data[i] = static_cast<T>(((i + seed) * 37) % 23);
+    }
+    return data;
+}
+
+template<typename T>
+std::vector<T> RunConvolution(const ConvolutionCase& testCase, ConvolutionMethod method, RefThreadPool& threadPool)
+{
+    const unsigned int batchSize      = 2;
+    const unsigned int inputChannels  = 5;
+    const unsigned int inputSize      = 9;
+    const unsigned int filterSize     = 3;
+    const unsigned int outputChannels = testCase.m_Depthwise ? inputChannels * testCase.m_DepthMultiplier : 6;
+    const unsigned int effectiveFilterSize = (filterSize - 1) * testCase.m_Dilation + 1;
+    const unsigned int outputSize =
+        (inputSize + 2 * testCase.m_Padding - effectiveFilterSize) / testCase.m_Stride + 1;
+
+    const bool nhwc = testCase.m_DataLayout == DataLayout::NHWC;
+    auto makeShape = [&](unsigned int n, unsigned int c, unsigned int h, unsigned int w)
+    {
+        return nhwc ? TensorShape({ n, h, w, c }) : TensorShape({ n, c, h, w });
+    };
+
+    const DataType biasType = testCase.m_DataType == DataType::QuantisedAsymm8 ? DataType::Signed32 : DataType::Float32;
+    const TensorInfo inputInfo(makeShape(batchSize, inputChannels, inputSize, inputSize),
+                               testCase.m_DataType, 0.5f, 3);
+    const TensorInfo outputInfo(makeShape(batchSize, outputChannels, outputSize, outputSize),
+                                testCase.m_DataType, 8.0f, 10);
+    const TensorInfo filterInfo(testCase.m_Depthwise ?
+                                    TensorShape({ testCase.m_DepthMultiplier, inputChannels, filterSize, filterSize }) :
+                                    makeShape(outputChannels, inputChannels, filterSize, filterSize),
+                                testCase.m_DataType, 0.25f, 7);
+    const TensorInfo biasInfo({ outputChannels }, biasType, 0.125f, 0);
+
+    std::vector<T> input  = MakeData<T>(inputInfo.GetNumElements(), 1);
+    std::vector<T> filter = MakeData<T>(filterInfo.GetNumElements(), 2);
+    std::vector<int32_t> quantizedBias = MakeData<int32_t>(biasInfo.GetNumElements(), 3);
+    std::vector<float> floatBias       = MakeData<float>(biasInfo.GetNumElements(), 3);
+    std::vector<T> output(outputInfo.GetNumElements());
+
+    void* biasData = biasType == DataType::Signed32 ? static_cast<void*>(quantizedBias.data()) : floatBias.data();
+    std::unique_ptr<Decoder<float>> biasDecoder = MakeDecoder<float>(biasInfo, biasData);
+
+    Convolve(threadPool, inputInfo.GetShape(), *MakeDecoder<float>(inputInfo, input.data()),
+             outputInfo.GetShape(), *MakeEncoder<float>(outputInfo, output.data()),
+             filterInfo.GetShape(), *MakeDecoder<float>(filterInfo, filter.data()),
+             testCase.m_BiasEnabled, testCase.m_BiasEnabled ? biasDecoder.get() : nullptr,
+             testCase.m_DataLayout, testCase.m_Padding, testCase.m_Padding,
+             testCase.m_Stride, testCase.m_Stride, testCase.m_Dilation, testCase.m_Dilation,
+             testCase.m_Depthwise, method);
+
+    return output;
+}
+
+template<typename T>
+void CheckMethodsMatch(const ConvolutionCase& testCase)
+{
+    RefThreadPool threadPool;
+    const std::vector<T> direct = RunConvolution<T>(testCase, ConvolutionMethod::Direct, threadPool);
+    const std::vector<T> gemm   = RunConvolution<T>(testCase, ConvolutionMethod::Gemm, threadPool);
+    BOOST_TEST(direct == gemm, boost::test_tools::per_element());
+}
+
+// The GEMM implementation computes these QAsymm8 convolutions with integer arithmetic, which rounds differently
+// from requantizing the float results.
+template<>
+void CheckMethodsMatch<uint8_t>(const ConvolutionCase& testCase)
+{
+    RefThreadPool threadPool;
+    const std::vector<uint8_t> direct = RunConvolution<uint8_t>(testCase, ConvolutionMethod::Direct, threadPool);
+    const std::vector<uint8_t> gemm   = RunConvolution<uint8_t>(testCase, ConvolutionMethod::Gemm, threadPool);
+    BOOST_TEST_REQUIRE(direct.size() == gemm.size());
+    for (size_t i = 0; i < direct.size(); ++i)
+    {
+        BOOST_TEST(std::abs(static_cast<int>(direct[i]) - static_cast<int>(gemm[i])) <= 1, "element " << i);
+    }
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(RefConvolutionMethods)
+
+BOOST_AUTO_TEST_CASE(GemmMatchesDirectConvolution2d)
+{
+    for (DataLayout dataLayout : { DataLayout::NCHW, DataLayout::NHWC })
+    {
+        CheckMethodsMatch<float>({ DataType::Float32, dataLayout, false, 1, 1, 1, 1, true });
+        CheckMethodsMatch<float>({ DataType::Float32, dataLayout, false, 1, 2, 1, 0, false });
+        CheckMethodsMatch<float>({ DataType::Float32, dataLayout, false, 1, 1, 2, 2, true });
+        CheckMethodsMatch<uint8_t>({ DataType::QuantisedAsymm8, dataLayout, false, 1, 1, 1, 1, true });
+        CheckMethodsMatch<uint8_t>({ DataType::QuantisedAsymm8, dataLayout, false, 1, 2, 2, 1, true });
+    }
+}
+
+BOOST_AUTO_TEST_CASE(GemmMatchesDirectDepthwiseConvolution2d)
+{
+    for (DataLayout dataLayout : { DataLayout::NCHW, DataLayout::NHWC })
+    {
+        CheckMethodsMatch<float>({ DataType::Float32, dataLayout, true, 1, 1, 1, 1, true });
+        CheckMethodsMatch<float>({ DataType::Float32, dataLayout, true, 2, 2, 1, 1, false });
+        CheckMethodsMatch<float>({ DataType::Float32, dataLayout, true, 3, 1, 2, 2, true });
+        CheckMethodsMatch<uint8_t>({ DataType::QuantisedAsymm8, dataLayout, true, 2, 1, 1, 1, true });
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ResultsDoNotDependOnTheThreadCount)
+{
+    // The ranges each work on their own copies of the iterators, so splitting the convolutions gives the same results.
+    RefThreadPool singleThread(1);
+    RefThreadPool fourThreads(4);
+    for (ConvolutionMethod method : { ConvolutionMethod::Direct, ConvolutionMethod::Gemm })
+    {
+        for (const ConvolutionCase& testCase : { ConvolutionCase{ DataType::Float32, DataLayout::NHWC,
+                                                                  false, 1, 1, 1, 1, true },
+                                                 ConvolutionCase{ DataType::Float32, DataLayout::NCHW,
+                                                                  true, 2, 1, 1, 1, true } })
+        {
+            const std::vector<float> expected = RunConvolution<float>(testCase, method, singleThread);
+            const std::vector<float> actual   = RunConvolution<float>(testCase, method, fourThreads);
+            BOOST_TEST(expected == actual, boost::test_tools::per_element());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
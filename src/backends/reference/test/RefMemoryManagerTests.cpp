@@ -7,6 +7,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <cstdint>
+
 BOOST_AUTO_TEST_SUITE(RefMemoryManagerTests)
 using namespace armnn;
 using Pool = RefMemoryManager::Pool;
@@ -48,4 +50,87 @@ BOOST_AUTO_TEST_CASE(ManageTwoThings)
     memoryManager.Release();
 }
 
+BOOST_AUTO_TEST_CASE(ReuseMemoryOfEndedLifetimes)
+{
+    RefMemoryManager memoryManager;
+
+    // A chain of layers, each reading the output of the previous one: input -> a -> b -> c.
+    Pool* input = memoryManager.Manage(100);
+    Pool* a = memoryManager.Manage(400);
+    memoryManager.Allocate(input);
+    Pool* b = memoryManager.Manage(100);
+    memoryManager.Allocate(a);
+    Pool* c = memoryManager.Manage(300);
+    memoryManager.Allocate(b);
+    memoryManager.Allocate(c);
+
+    memoryManager.PlanMemory();
+
+    // Sizes are rounded up to the alignment of the arena. At most two tensors are alive at a time, the largest
+    // pair being a and b.
+    BOOST_CHECK_EQUAL(memoryManager.GetManagedBytes(), 928);
+    BOOST_CHECK_EQUAL(memoryManager.GetPlannedBytes(), 512);
+
+    memoryManager.Acquire();
+
+    auto address = [&](Pool* pool) { return reinterpret_cast<uintptr_t>(memoryManager.GetPointer(pool)); };
+    auto overlap = [&](Pool* lhs, unsigned int lhsSize, Pool* rhs, unsigned int rhsSize)
+    {
+        return address(lhs) < address(rhs) + rhsSize && address(rhs) < address(lhs) + lhsSize;
+    };
+
+    // Tensors alive at the same time don't share memory.
+    BOOST_CHECK(!overlap(input, 100, a, 400));
+    BOOST_CHECK(!overlap(a, 400, b, 100));
+    BOOST_CHECK(!overlap(b, 100, c, 300));
+
+    // The others do.
+    BOOST_CHECK(overlap(a, 400, c, 300));
+
+    memoryManager.Release();
+}
+
+BOOST_AUTO_TEST_CASE(ReuseMergedGaps)
+{
+    RefMemoryManager memoryManager;
+
+    // Two tensors freed next to each other leave a single gap, which a tensor of their combined size fits in.
+    Pool* a = memoryManager.Manage(64);
+    Pool* b = memoryManager.Manage(64);
+    Pool* c = memoryManager.Manage(64);
+    memoryManager.Allocate(a);
+    memoryManager.Allocate(b);
+    Pool* d = memoryManager.Manage(128);
+    memoryManager.Allocate(c);
+    memoryManager.Allocate(d);
+
+    IMemoryManager& iMemoryManager = memoryManager;
+    iMemoryManager.PlanMemory();
+    BOOST_CHECK_EQUAL(iMemoryManager.GetManagedBytes(), 320);
+    BOOST_CHECK_EQUAL(iMemoryManager.GetPlannedBytes(), 192);
+
+    memoryManager.Acquire();
+    BOOST_CHECK(memoryManager.GetPointer(d) == memoryManager.GetPointer(a));
+    BOOST_CHECK(memoryManager.GetPointer(c) != memoryManager.GetPointer(a));
+    memoryManager.Release();
+}
+
+BOOST_AUTO_TEST_CASE(PlanAgainAfterNewTensors)
+{
+    RefMemoryManager memoryManager;
+
+    Pool* pool1 = memoryManager.Manage(64);
+    memoryManager.Allocate(pool1);
+    memoryManager.PlanMemory();
+    BOOST_CHECK_EQUAL(memoryManager.GetPlannedBytes(), 64);
+
+    Pool* pool2 = memoryManager.Manage(128);
+
+    // Acquire() plans the new tensor, which lives until the end of execution.
+    memoryManager.Acquire();
+    BOOST_CHECK_EQUAL(memoryManager.GetPlannedBytes(), 128);
+    BOOST_CHECK(memoryManager.GetPointer(pool2) != nullptr);
+    memoryManager.Release();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,184 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/workloads/Decoders.hpp>
+#include <reference/workloads/ElementwiseFunction.hpp>
+#include <reference/workloads/Encoders.hpp>
+#include <reference/workloads/FullyConnected.hpp>
+#include <reference/workloads/Pooling2d.hpp>
+
+#include <armnn/TypesUtils.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+namespace
+{
+
+using namespace armnn;
+
+std::vector<uint8_t> MakeQuantizedData(unsigned int numElements, unsigned int seed)
+{
+    std::vector<uint8_t> data(numElements);
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        data[i] = static_cast<uint8_t>(((i + seed) * 97) % 256);
+    }
+    return data;
+}
+
+std::vector<float> Dequantize(const std::vector<uint8_t>& data, const TensorInfo& info)
+{
+    std::vector<float> result(data.size());
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        result[i] = armnn::Dequantize(data[i], info.GetQuantizationScale(), info.GetQuantizationOffset());
+    }
+    return result;
+}
+
+// The integer kernels round differently from the float computation followed by a quantization, so each output may
+// differ from the quantized float result by one.
+void CheckWithinOne(const std::vector<uint8_t>& actual, const std::vector<float>& expected, const TensorInfo& info)
+{
+    BOOST_TEST_REQUIRE(actual.size() == expected.size());
+    for (size_t i = 0; i < actual.size(); ++i)
+    {
+        const int expectedValue = Quantize<uint8_t>(expected[i], info.GetQuantizationScale(),
+                                                    info.GetQuantizationOffset());
+        BOOST_TEST(std::abs(static_cast<int>(actual[i]) - expectedValue) <= 1, "element " << i);
+    }
+}
+
+TensorInfo ToFloat32(const TensorInfo& info)
+{
+    return TensorInfo(info.GetShape(), DataType::Float32);
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(RefQuantizedArithmetic)
+
+BOOST_AUTO_TEST_CASE(FullyConnectedQAsymm8MatchesFloat)
+{
+    const unsigned int batchSize  = 3;
+    const unsigned int inputSize  = 40;
+    const unsigned int outputSize = 7;
+
+    const TensorInfo inputInfo({ batchSize, inputSize }, DataType::QuantisedAsymm8, 0.1f, 120);
+    const TensorInfo outputInfo({ batchSize, outputSize }, DataType::QuantisedAsymm8, 2.0f, 100);
+    const TensorInfo biasInfo({ outputSize }, DataType::Signed32, 0.1f * 0.02f, 0);
+
+    std::vector<uint8_t> input = MakeQuantizedData(inputInfo.GetNumElements(), 1);
+    std::vector<int32_t> bias({ -3000, -2000, -1000, 0, 1000, 2000, 3000 });
+
+    RefThreadPool threadPool;
+    for (bool transposeWeights : { false, true })
+    {
+        const TensorInfo weightInfo(transposeWeights ? TensorShape({ outputSize, inputSize }) :
+                                                       TensorShape({ inputSize, outputSize }),
+                                    DataType::QuantisedAsymm8, 0.02f, 128);
+        std::vector<uint8_t> weights = MakeQuantizedData(weightInfo.GetNumElements(), 2);
+
+        std::vector<uint8_t> output(outputInfo.GetNumElements());
+        FullyConnected(threadPool, inputInfo.GetShape(), *MakeDecoder<float>(inputInfo, input.data()),
+                       outputInfo.GetShape(), *MakeEncoder<float>(outputInfo, output.data()),
+                       *MakeDecoder<float>(weightInfo, weights.data()), *MakeDecoder<float>(biasInfo, bias.data()),
+                       true, inputSize, transposeWeights);
+
+        std::vector<float> floatInput   = Dequantize(input, inputInfo);
+        std::vector<float> floatWeights = Dequantize(weights, weightInfo);
+        std::vector<float> floatBias(outputSize);
+        for (unsigned int i = 0; i < outputSize; ++i)
+        {
+            floatBias[i] = static_cast<float>(bias[i]) * biasInfo.GetQuantizationScale();
+        }
+
+        std::vector<float> expected(outputInfo.GetNumElements());
+        FullyConnected(threadPool, inputInfo.GetShape(),
+                       *MakeDecoder<float>(ToFloat32(inputInfo), floatInput.data()),
+                       outputInfo.GetShape(), *MakeEncoder<float>(ToFloat32(outputInfo), expected.data()),
+                       *MakeDecoder<float>(ToFloat32(weightInfo), floatWeights.data()),
+                       *MakeDecoder<float>(ToFloat32(biasInfo), floatBias.data()),
+                       true, inputSize, transposeWeights);
+
+        CheckWithinOne(output, expected, outputInfo);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Pooling2dQAsymm8MatchesFloat)
+{
+    const TensorInfo inputInfo({ 1, 2, 7, 7 }, DataType::QuantisedAsymm8, 0.5f, 10);
+    std::vector<uint8_t> input = MakeQuantizedData(inputInfo.GetNumElements(), 3);
+    std::vector<float> floatInput = Dequantize(input, inputInfo);
+
+    for (PoolingAlgorithm algorithm : { PoolingAlgorithm::Max, PoolingAlgorithm::Average })
+    {
+        for (PaddingMethod paddingMethod : { PaddingMethod::Exclude, PaddingMethod::IgnoreValue })
+        {
+            Pooling2dDescriptor descriptor;
+            descriptor.m_PoolType      = algorithm;
+            descriptor.m_PaddingMethod = paddingMethod;
+            descriptor.m_PoolWidth     = 3;
+            descriptor.m_PoolHeight    = 3;
+            descriptor.m_StrideX       = 2;
+            descriptor.m_StrideY       = 2;
+            descriptor.m_PadLeft       = 1;
+            descriptor.m_PadRight      = 1;
+            descriptor.m_PadTop        = 1;
+            descriptor.m_PadBottom     = 1;
+            descriptor.m_DataLayout    = DataLayout::NCHW;
+
+            // Same quantization as the input, and a coarser one which needs requantizing.
+            for (float outputScale : { 0.5f, 0.75f })
+            {
+                const TensorInfo outputInfo({ 1, 2, 4, 4 }, DataType::QuantisedAsymm8, outputScale, 10);
+
+                std::vector<uint8_t> output(outputInfo.GetNumElements());
+                Pooling2d(*MakeDecoder<float>(inputInfo, input.data()),
+                          *MakeEncoder<float>(outputInfo, output.data()),
+                          inputInfo, outputInfo, descriptor);
+
+                std::vector<float> expected(outputInfo.GetNumElements());
+                Pooling2d(*MakeDecoder<float>(ToFloat32(inputInfo), floatInput.data()),
+                          *MakeEncoder<float>(ToFloat32(outputInfo), expected.data()),
+                          ToFloat32(inputInfo), ToFloat32(outputInfo), descriptor);
+
+                CheckWithinOne(output, expected, outputInfo);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(AdditionQAsymm8MatchesFloat)
+{
+    const TensorInfo inputInfo0({ 2, 3, 4 }, DataType::QuantisedAsymm8, 0.25f, 50);
+    const TensorInfo inputInfo1({ 1, 3, 1 }, DataType::QuantisedAsymm8, 0.75f, 200);
+    const TensorInfo outputInfo({ 2, 3, 4 }, DataType::QuantisedAsymm8, 0.5f, 90);
+
+    std::vector<uint8_t> input0 = MakeQuantizedData(inputInfo0.GetNumElements(), 4);
+    std::vector<uint8_t> input1 = MakeQuantizedData(inputInfo1.GetNumElements(), 5);
+    std::vector<float> floatInput0 = Dequantize(input0, inputInfo0);
+    std::vector<float> floatInput1 = Dequantize(input1, inputInfo1);
+
+    std::vector<uint8_t> output(outputInfo.GetNumElements());
+    ElementwiseFunction<std::plus<float>>(inputInfo0.GetShape(), inputInfo1.GetShape(), outputInfo.GetShape(),
+                                          *MakeDecoder<float>(inputInfo0, input0.data()),
+                                          *MakeDecoder<float>(inputInfo1, input1.data()),
+                                          *MakeEncoder<float>(outputInfo, output.data()));
+
+    std::vector<float> expected(outputInfo.GetNumElements());
+    ElementwiseFunction<std::plus<float>>(inputInfo0.GetShape(), inputInfo1.GetShape(), outputInfo.GetShape(),
+                                          *MakeDecoder<float>(ToFloat32(inputInfo0), floatInput0.data()),
+                                          *MakeDecoder<float>(ToFloat32(inputInfo1), floatInput1.data()),
+                                          *MakeEncoder<float>(ToFloat32(outputInfo), expected.data()));
+
+    CheckWithinOne(output, expected, outputInfo);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
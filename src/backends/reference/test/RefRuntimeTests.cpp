@@ -9,10 +9,481 @@
 
 #include <backendsCommon/test/RuntimeTestImpl.hpp>
 
+#include <reference/RefBackend.hpp>
+#include <reference/RefBackendContext.hpp>
+
 #include <boost/test/unit_test.hpp>
 
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+
+// Input -> FullyConnected -> ReLu -> Addition (with a Constant) -> Output
+armnn::INetworkPtr CreateWorkingMemTestNetwork(const std::vector<float>& weights,
+                                               const std::vector<float>& constant)
+{
+    using namespace armnn;
+
+    TensorInfo inputInfo({ 1, 4 }, DataType::Float32);
+    TensorInfo weightsInfo({ 4, 4 }, DataType::Float32);
+    TensorInfo outputInfo({ 1, 4 }, DataType::Float32);
+
+    INetworkPtr net(INetwork::Create());
+
+    IConnectableLayer* input = net->AddInputLayer(0);
+
+    FullyConnectedDescriptor fullyConnectedDesc;
+    IConnectableLayer* fullyConnected =
+        net->AddFullyConnectedLayer(fullyConnectedDesc, ConstTensor(weightsInfo, weights), EmptyOptional());
+
+    ActivationDescriptor activationDesc;
+    activationDesc.m_Function = ActivationFunction::ReLu;
+    IConnectableLayer* activation = net->AddActivationLayer(activationDesc);
+
+    IConnectableLayer* constantLayer = net->AddConstantLayer(ConstTensor(outputInfo, constant));
+    IConnectableLayer* addition = net->AddAdditionLayer();
+
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(fullyConnected->GetInputSlot(0));
+    fullyConnected->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+    constantLayer->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+    addition->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    fullyConnected->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    activation->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    constantLayer->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    addition->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+    return net;
+}
+
+} // anonymous namespace
+
 BOOST_AUTO_TEST_SUITE(RefRuntime)
 
+BOOST_AUTO_TEST_CASE(RuntimeConcurrentExecuteCpuRef)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    std::vector<float> weights =
+    {
+        1.0f, -2.0f, 0.5f,  0.0f,
+        0.0f,  1.0f, 2.0f, -1.0f,
+        3.0f,  0.0f, 1.0f,  1.0f,
+       -1.0f,  1.0f, 0.0f,  2.0f
+    };
+    std::vector<float> constant = { 0.5f, 1.0f, -1.0f, 2.0f };
+
+    INetworkPtr net = CreateWorkingMemTestNetwork(weights, constant);
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    // Results of the regular, serialized execution for a few different inputs.
+    const unsigned int numInputs = 8;
+    std::vector<std::vector<float>> inputData(numInputs);
+    std::vector<std::vector<float>> expectedOutputData(numInputs);
+    for (unsigned int i = 0; i < numInputs; ++i)
+    {
+        inputData[i] = { static_cast<float>(i), 1.0f - static_cast<float>(i), 2.0f, -0.5f * static_cast<float>(i) };
+        expectedOutputData[i].resize(4);
+
+        InputTensors inputTensors
+        {
+            { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData[i].data()) }
+        };
+        OutputTensors outputTensors
+        {
+            { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), expectedOutputData[i].data()) }
+        };
+        BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    }
+
+    const unsigned int numThreads = 4;
+    const unsigned int numIterations = 50;
+
+    std::vector<std::unique_ptr<IWorkingMemHandle>> workingMemHandles;
+    for (unsigned int t = 0; t < numThreads; ++t)
+    {
+        workingMemHandles.push_back(runtime->CreateWorkingMemHandle(netId));
+        BOOST_TEST(workingMemHandles.back()->GetNetworkId() == netId);
+        BOOST_TEST(workingMemHandles.back()->GetSizeInBytes() > 0);
+    }
+
+    // Boost.Test assertions are not thread safe, so each thread only records whether all its results matched.
+    std::vector<char> threadSucceeded(numThreads, 0);
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back([&, t]()
+        {
+            bool succeeded = true;
+            std::vector<float> outputData(4);
+            for (unsigned int iteration = 0; iteration < numIterations; ++iteration)
+            {
+                const unsigned int i = (t + iteration) % numInputs;
+
+                InputTensors inputTensors
+                {
+                    { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData[i].data()) }
+                };
+                OutputTensors outputTensors
+                {
+                    { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) }
+                };
+
+                succeeded &= runtime->Execute(*workingMemHandles[t], inputTensors, outputTensors) == Status::Success;
+                succeeded &= outputData == expectedOutputData[i];
+            }
+            threadSucceeded[t] = succeeded;
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (unsigned int t = 0; t < numThreads; ++t)
+    {
+        BOOST_TEST(threadSucceeded[t]);
+    }
+
+    // The network can still be run the usual way afterwards.
+    std::vector<float> outputData(4);
+    InputTensors inputTensors
+    {
+        { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData[1].data()) }
+    };
+    OutputTensors outputTensors
+    {
+        { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) }
+    };
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    BOOST_TEST(outputData == expectedOutputData[1]);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeEnqueueWorkloadAsyncCpuRef)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    options.m_AsyncExecutionThreads = 3;
+    options.m_AsyncQueueCapacity = 4;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    std::vector<float> weights =
+    {
+        1.0f, -2.0f, 0.5f,  0.0f,
+        0.0f,  1.0f, 2.0f, -1.0f,
+        3.0f,  0.0f, 1.0f,  1.0f,
+       -1.0f,  1.0f, 0.0f,  2.0f
+    };
+    std::vector<float> constant = { 0.5f, 1.0f, -1.0f, 2.0f };
+
+    INetworkPtr net = CreateWorkingMemTestNetwork(weights, constant);
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    // More requests than the queue can hold, so that scheduling them has to wait for the workers.
+    const unsigned int numRequests = 16;
+    std::vector<std::vector<float>> inputData(numRequests);
+    std::vector<std::vector<float>> expectedOutputData(numRequests, std::vector<float>(4));
+    std::vector<std::vector<float>> outputData(numRequests, std::vector<float>(4));
+    std::vector<std::vector<float>> callbackOutputData(numRequests, std::vector<float>(4));
+    for (unsigned int i = 0; i < numRequests; ++i)
+    {
+        inputData[i] = { static_cast<float>(i), 1.0f - static_cast<float>(i), 2.0f, -0.5f * static_cast<float>(i) };
+
+        InputTensors inputTensors
+        {
+            { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData[i].data()) }
+        };
+        OutputTensors outputTensors
+        {
+            { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), expectedOutputData[i].data()) }
+        };
+        BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    }
+
+    std::vector<std::future<Status>> futures;
+    for (unsigned int i = 0; i < numRequests; ++i)
+    {
+        InputTensors inputTensors
+        {
+            { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData[i].data()) }
+        };
+        OutputTensors outputTensors
+        {
+            { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData[i].data()) }
+        };
+        futures.push_back(runtime->EnqueueWorkloadAsync(netId, inputTensors, outputTensors));
+    }
+
+    for (unsigned int i = 0; i < numRequests; ++i)
+    {
+        BOOST_TEST(futures[i].get() == Status::Success);
+        BOOST_TEST(outputData[i] == expectedOutputData[i]);
+    }
+
+    // The same requests again, notified through callbacks.
+    std::mutex mutex;
+    std::condition_variable completed;
+    unsigned int numSucceeded = 0;
+    unsigned int numCompleted = 0;
+    for (unsigned int i = 0; i < numRequests; ++i)
+    {
+        InputTensors inputTensors
+        {
+            { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData[i].data()) }
+        };
+        OutputTensors outputTensors
+        {
+            { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), callbackOutputData[i].data()) }
+        };
+        runtime->EnqueueWorkloadAsync(netId, inputTensors, outputTensors, [&](Status status)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            numSucceeded += status == Status::Success ? 1 : 0;
+            ++numCompleted;
+            completed.notify_one();
+        });
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        completed.wait(lock, [&] { return numCompleted == numRequests; });
+    }
+    BOOST_TEST(numSucceeded == numRequests);
+    BOOST_TEST(callbackOutputData == expectedOutputData);
+
+    // A request for a network that isn't loaded reports a failure instead of throwing on a worker thread.
+    BOOST_TEST(runtime->UnloadNetwork(netId) == Status::Success);
+    InputTensors inputTensors
+    {
+        { 0, ConstTensor(TensorInfo({ 1, 4 }, DataType::Float32), inputData[0].data()) }
+    };
+    OutputTensors outputTensors
+    {
+        { 0, Tensor(TensorInfo({ 1, 4 }, DataType::Float32), outputData[0].data()) }
+    };
+    BOOST_TEST(runtime->EnqueueWorkloadAsync(netId, inputTensors, outputTensors).get() == Status::Failure);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeEnqueueWorkloadAsyncPriorityCpuRef)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    options.m_AsyncExecutionThreads = 1;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    std::vector<float> weights(16, 1.0f);
+    std::vector<float> constant(4, 0.0f);
+
+    INetworkPtr net = CreateWorkingMemTestNetwork(weights, constant);
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    std::vector<float> inputData(4, 1.0f);
+    std::vector<std::vector<float>> outputData(6, std::vector<float>(4));
+    auto makeInputs = [&]()
+    {
+        return InputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) } };
+    };
+    auto makeOutputs = [&](size_t i)
+    {
+        return OutputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData[i].data()) } };
+    };
+
+    // The single worker is held in the callback of the first request while the others are queued.
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<void> started;
+
+    std::mutex mutex;
+    std::vector<int> completionOrder;
+    auto recordCompletion = [&](int id)
+    {
+        return [&, id](Status)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            completionOrder.push_back(id);
+        };
+    };
+
+    runtime->EnqueueWorkloadAsync(netId, makeInputs(), makeOutputs(0), [&](Status)
+    {
+        started.set_value();
+        released.wait();
+    });
+    started.get_future().wait();
+
+    runtime->EnqueueWorkloadAsync(netId, makeInputs(), makeOutputs(1), recordCompletion(1), QosExecPriority::Low);
+    runtime->EnqueueWorkloadAsync(netId, makeInputs(), makeOutputs(2), recordCompletion(2), QosExecPriority::Medium);
+    runtime->EnqueueWorkloadAsync(netId, makeInputs(), makeOutputs(3), recordCompletion(3), QosExecPriority::High);
+    std::future<Status> last =
+        runtime->EnqueueWorkloadAsync(netId, makeInputs(), makeOutputs(4), QosExecPriority::Low);
+    runtime->EnqueueWorkloadAsync(netId, makeInputs(), makeOutputs(5), recordCompletion(4), QosExecPriority::High);
+
+    release.set_value();
+    BOOST_TEST(last.get() == Status::Success);
+
+    // Highest priority first, and in submission order within a priority.
+    std::vector<int> expectedOrder = { 3, 4, 2, 1 };
+    std::lock_guard<std::mutex> lock(mutex);
+    BOOST_TEST(completionOrder == expectedOrder);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeMultithreadedKernelsCpuRef)
+{
+    using namespace armnn;
+
+    // Input -> Convolution2d -> DepthwiseConvolution2d -> FullyConnected -> Output, large enough for the kernels
+    // to be split between several threads.
+    TensorInfo inputInfo({ 1, 32, 32, 8 }, DataType::Float32);
+    TensorInfo convWeightsInfo({ 8, 3, 3, 8 }, DataType::Float32);
+    TensorInfo depthwiseWeightsInfo({ 1, 8, 3, 3 }, DataType::Float32);
+    TensorInfo biasInfo({ 8 }, DataType::Float32);
+    TensorInfo fullyConnectedWeightsInfo({ 32 * 32 * 8, 32 }, DataType::Float32);
+    TensorInfo fullyConnectedBiasInfo({ 32 }, DataType::Float32);
+    TensorInfo outputInfo({ 1, 32 }, DataType::Float32);
+
+    auto makeData = [](unsigned int numElements)
+    {
+        std::vector<float> data(numElements);
+        for (unsigned int i = 0; i < numElements; ++i)
+        {
+            data[i] = static_cast<float>(static_cast<int>((i * 7) % 11) - 5) * 0.1f;
+        }
+        return data;
+    };
+
+    std::vector<float> convWeights           = makeData(convWeightsInfo.GetNumElements());
+    std::vector<float> depthwiseWeights      = makeData(depthwiseWeightsInfo.GetNumElements());
+    std::vector<float> biases                = makeData(biasInfo.GetNumElements());
+    std::vector<float> fullyConnectedWeights = makeData(fullyConnectedWeightsInfo.GetNumElements());
+    std::vector<float> fullyConnectedBiases  = makeData(fullyConnectedBiasInfo.GetNumElements());
+    std::vector<float> inputData             = makeData(inputInfo.GetNumElements());
+
+    auto runNetwork = [&](unsigned int numThreads)
+    {
+        IRuntime::CreationOptions options;
+        options.m_CpuRefNumThreads = numThreads;
+        IRuntimePtr runtime(IRuntime::Create(options));
+
+        INetworkPtr net(INetwork::Create());
+
+        Convolution2dDescriptor convDesc;
+        convDesc.m_PadLeft     = 1;
+        convDesc.m_PadRight    = 1;
+        convDesc.m_PadTop      = 1;
+        convDesc.m_PadBottom   = 1;
+        convDesc.m_StrideX     = 1;
+        convDesc.m_StrideY     = 1;
+        convDesc.m_BiasEnabled = true;
+        convDesc.m_DataLayout  = DataLayout::NHWC;
+
+        DepthwiseConvolution2dDescriptor depthwiseDesc;
+        depthwiseDesc.m_PadLeft     = 1;
+        depthwiseDesc.m_PadRight    = 1;
+        depthwiseDesc.m_PadTop      = 1;
+        depthwiseDesc.m_PadBottom   = 1;
+        depthwiseDesc.m_StrideX     = 1;
+        depthwiseDesc.m_StrideY     = 1;
+        depthwiseDesc.m_BiasEnabled = true;
+        depthwiseDesc.m_DataLayout  = DataLayout::NHWC;
+
+        FullyConnectedDescriptor fullyConnectedDesc;
+        fullyConnectedDesc.m_BiasEnabled = true;
+
+        IConnectableLayer* input = net->AddInputLayer(0);
+        IConnectableLayer* conv = net->AddConvolution2dLayer(convDesc,
+                                                             ConstTensor(convWeightsInfo, convWeights),
+                                                             Optional<ConstTensor>(ConstTensor(biasInfo, biases)));
+        IConnectableLayer* depthwise =
+            net->AddDepthwiseConvolution2dLayer(depthwiseDesc,
+                                                ConstTensor(depthwiseWeightsInfo, depthwiseWeights),
+                                                Optional<ConstTensor>(ConstTensor(biasInfo, biases)));
+        IConnectableLayer* fullyConnected =
+            net->AddFullyConnectedLayer(fullyConnectedDesc,
+                                        ConstTensor(fullyConnectedWeightsInfo, fullyConnectedWeights),
+                                        Optional<ConstTensor>(ConstTensor(fullyConnectedBiasInfo,
+                                                                          fullyConnectedBiases)));
+        IConnectableLayer* output = net->AddOutputLayer(0);
+
+        input->GetOutputSlot(0).Connect(conv->GetInputSlot(0));
+        conv->GetOutputSlot(0).Connect(depthwise->GetInputSlot(0));
+        depthwise->GetOutputSlot(0).Connect(fullyConnected->GetInputSlot(0));
+        fullyConnected->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+        input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+        conv->GetOutputSlot(0).SetTensorInfo(inputInfo);
+        depthwise->GetOutputSlot(0).SetTensorInfo(inputInfo);
+        fullyConnected->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+        std::vector<BackendId> backends = { Compute::CpuRef };
+        IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+        NetworkId netId;
+        BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+        std::vector<float> outputData(outputInfo.GetNumElements());
+        InputTensors inputTensors
+        {
+            { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) }
+        };
+        OutputTensors outputTensors
+        {
+            { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) }
+        };
+        BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+        return outputData;
+    };
+
+    // Splitting the kernels doesn't change the order of the operations computing each output,
+    // so the results must be identical.
+    const std::vector<float> singleThreadedOutput = runNetwork(1);
+    BOOST_TEST(runNetwork(3) == singleThreadedOutput);
+    BOOST_TEST(runNetwork(4) == singleThreadedOutput);
+    BOOST_TEST(runNetwork(1) == singleThreadedOutput);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimesHaveTheirOwnCpuRefThreadPools)
+{
+    using namespace armnn;
+
+    RefBackend backend;
+
+    IRuntime::CreationOptions options;
+    options.m_CpuRefNumThreads = 2;
+    IBackendInternal::IBackendContextPtr firstContext = backend.CreateBackendContext(options);
+    options.m_CpuRefNumThreads = 3;
+    IBackendInternal::IBackendContextPtr secondContext = backend.CreateBackendContext(options);
+
+    // Creating the second context, as a second runtime does, leaves the pool of the first one alone.
+    BOOST_TEST(static_cast<RefBackendContext&>(*firstContext).GetThreadPool()->GetNumThreads() == 2);
+    BOOST_TEST(static_cast<RefBackendContext&>(*secondContext).GetThreadPool()->GetNumThreads() == 3);
+}
+
 #ifdef ARMNN_LEAK_CHECKING_ENABLED
 BOOST_AUTO_TEST_CASE(RuntimeMemoryLeaksCpuRef)
 {
@@ -43,4 +514,64 @@ BOOST_AUTO_TEST_CASE(RuntimeMemoryLeaksCpuRef)
 }
 #endif
 
+BOOST_AUTO_TEST_CASE(RuntimeWorkingMemoryStatisticsCpuRef)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    std::vector<float> weights(16, 1.0f);
+    std::vector<float> constant(4, 1.0f);
+    INetworkPtr net = CreateWorkingMemTestNetwork(weights, constant);
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    // The intermediate tensors of the network share memory.
+    WorkingMemoryStatistics statistics = runtime->GetWorkingMemoryStatistics(netId);
+    BOOST_TEST(statistics.m_PlannedBytes > 0);
+    BOOST_TEST(statistics.m_PlannedBytes < statistics.m_ManagedBytes);
+
+    // So do the ones of a working memory handle: of its five tensors of 16 bytes, at most three are alive at the
+    // same time.
+    std::unique_ptr<IWorkingMemHandle> workingMemHandle = runtime->CreateWorkingMemHandle(netId);
+    BOOST_TEST(workingMemHandle->GetSizeInBytes() == 3 * 16);
+
+    std::vector<float> inputData = { 1.0f, 2.0f, 3.0f, 4.0f };
+    std::vector<float> outputData(4);
+    InputTensors inputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) } };
+    BOOST_TEST(runtime->Execute(*workingMemHandle, inputTensors, outputTensors) == Status::Success);
+    BOOST_TEST(outputData == std::vector<float>(4, 11.0f), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeExecuteChecksTheNumberOfTensorsCpuRef)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    std::vector<float> weights(16, 1.0f);
+    std::vector<float> constant(4, 1.0f);
+    INetworkPtr net = CreateWorkingMemTestNetwork(weights, constant);
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+    std::unique_ptr<IWorkingMemHandle> workingMemHandle = runtime->CreateWorkingMemHandle(netId);
+
+    std::vector<float> inputData(4);
+    std::vector<float> outputData(4);
+    InputTensors inputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) } };
+
+    BOOST_CHECK_THROW(runtime->Execute(*workingMemHandle, InputTensors(), outputTensors), InvalidArgumentException);
+    BOOST_CHECK_THROW(runtime->Execute(*workingMemHandle, inputTensors, OutputTensors()), InvalidArgumentException);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -0,0 +1,106 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/workloads/Activation.hpp>
+#include <reference/workloads/Decoders.hpp>
+#include <reference/workloads/ElementwiseFunction.hpp>
+#include <reference/workloads/Encoders.hpp>
+
+#include <armnn/TypesUtils.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <functional>
+
+BOOST_AUTO_TEST_SUITE(RefTypedKernels)
+
+BOOST_AUTO_TEST_CASE(ActivationQAsymm8MatchesPerElementResult)
+{
+    using namespace armnn;
+
+    // Enough elements for the lookup table path to be taken.
+    const TensorInfo inputInfo({ 4, 300 }, DataType::QuantisedAsymm8, 0.05f, 100);
+    const TensorInfo outputInfo({ 4, 300 }, DataType::QuantisedAsymm8, 1.0f / 256.0f, 0);
+
+    std::vector<uint8_t> inputValues(inputInfo.GetNumElements());
+    for (size_t i = 0; i < inputValues.size(); ++i)
+    {
+        inputValues[i] = static_cast<uint8_t>((i * 37) % 256);
+    }
+
+    std::vector<uint8_t> outputValues(outputInfo.GetNumElements());
+    Activation(*MakeDecoder<float>(inputInfo, inputValues.data()),
+               *MakeEncoder<float>(outputInfo, outputValues.data()),
+               inputInfo,
+               ActivationFunction::Sigmoid,
+               0.0f,
+               0.0f);
+
+    for (size_t i = 0; i < inputValues.size(); ++i)
+    {
+        const float input = Dequantize(inputValues[i], inputInfo.GetQuantizationScale(),
+                                       inputInfo.GetQuantizationOffset());
+        const uint8_t expected = Quantize<uint8_t>(Activation(input, ActivationFunction::Sigmoid, 0.0f, 0.0f),
+                                                   outputInfo.GetQuantizationScale(),
+                                                   outputInfo.GetQuantizationOffset());
+        BOOST_TEST(outputValues[i] == expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ActivationFloat32StartsAtIteratorPosition)
+{
+    using namespace armnn;
+
+    const TensorInfo tensorInfo({ 4 }, DataType::Float32);
+
+    std::vector<float> inputValues({ 9.0f, 9.0f, -1.0f, 2.0f, -3.0f, 4.0f });
+    std::vector<float> outputValues(6, 0.0f);
+
+    std::unique_ptr<Decoder<float>> decoder = MakeDecoder<float>(tensorInfo, inputValues.data());
+    std::unique_ptr<Encoder<float>> encoder = MakeEncoder<float>(tensorInfo, outputValues.data());
+    *decoder += 2;
+    *encoder += 1;
+
+    Activation(*decoder, *encoder, tensorInfo, ActivationFunction::ReLu, 0.0f, 0.0f);
+
+    std::vector<float> expectedValues({ 0.0f, 0.0f, 2.0f, 0.0f, 4.0f, 0.0f });
+    BOOST_CHECK_EQUAL_COLLECTIONS(outputValues.begin(), outputValues.end(),
+                                  expectedValues.begin(), expectedValues.end());
+}
+
+BOOST_AUTO_TEST_CASE(ElementwiseFloat32SameShapeAndBroadcast)
+{
+    using namespace armnn;
+
+    const TensorInfo tensorInfo({ 2, 3 }, DataType::Float32);
+    const TensorInfo broadcastInfo({ 1, 3 }, DataType::Float32);
+
+    std::vector<float> input0({ 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f });
+    std::vector<float> input1({ 10.0f, 20.0f, 30.0f, 40.0f, 50.0f, 60.0f });
+    std::vector<float> output(6);
+
+    ElementwiseFunction<std::plus<float>>(tensorInfo.GetShape(),
+                                          tensorInfo.GetShape(),
+                                          tensorInfo.GetShape(),
+                                          *MakeDecoder<float>(tensorInfo, input0.data()),
+                                          *MakeDecoder<float>(tensorInfo, input1.data()),
+                                          *MakeEncoder<float>(tensorInfo, output.data()));
+
+    std::vector<float> expectedSum({ 11.0f, 22.0f, 33.0f, 44.0f, 55.0f, 66.0f });
+    BOOST_CHECK_EQUAL_COLLECTIONS(output.begin(), output.end(), expectedSum.begin(), expectedSum.end());
+
+    ElementwiseFunction<std::plus<float>>(tensorInfo.GetShape(),
+                                          broadcastInfo.GetShape(),
+                                          tensorInfo.GetShape(),
+                                          *MakeDecoder<float>(tensorInfo, input0.data()),
+                                          *MakeDecoder<float>(broadcastInfo, input1.data()),
+                                          *MakeEncoder<float>(tensorInfo, output.data()));
+
+    std::vector<float> expectedBroadcastSum({ 11.0f, 22.0f, 33.0f, 14.0f, 25.0f, 36.0f });
+    BOOST_CHECK_EQUAL_COLLECTIONS(output.begin(), output.end(),
+                                  expectedBroadcastSum.begin(), expectedBroadcastSum.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
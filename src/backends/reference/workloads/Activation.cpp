@@ -4,9 +4,11 @@
 //
 
 #include "Activation.hpp"
+#include "IteratorDispatch.hpp"
 
 #include <boost/log/trivial.hpp>
 
+#include <array>
 #include <cmath>
 
 namespace armnn
@@ -81,15 +83,17 @@ float Activation(float in,
 }
 
 
-void Activation(Decoder<float>& in,
-                Encoder<float>& out,
-                const TensorInfo& tensorInfo,
-                ActivationFunction function,
-                float a,
-                float b)
+namespace
 {
-    unsigned int numElements = tensorInfo.GetNumElements();
 
+template<typename DecoderType, typename EncoderType>
+void ActivationImpl(DecoderType& in,
+                    EncoderType& out,
+                    unsigned int numElements,
+                    ActivationFunction function,
+                    float a,
+                    float b)
+{
     for (unsigned int i = 0; i < numElements; i++)
     {
         out.Set(Activation(in.Get(), function, a, b));
@@ -100,4 +104,107 @@ void Activation(Decoder<float>& in,
     out -= numElements;
 }
 
+template<ActivationFunction Function>
+void ActivationImpl(const float* in, float* out, unsigned int numElements, float a, float b)
+{
+    // The function is a constant here, so the switch in Activation() folds away and the loop can be vectorized.
+    for (unsigned int i = 0; i < numElements; i++)
+    {
+        out[i] = Activation(in[i], Function, a, b);
+    }
+}
+
+void ActivationImpl(Float32Decoder& in,
+                    Float32Encoder& out,
+                    unsigned int numElements,
+                    ActivationFunction function,
+                    float a,
+                    float b)
+{
+    const float* inData = in.GetPointer();
+    float* outData = out.GetPointer();
+
+    switch (function)
+    {
+        case ActivationFunction::Linear:
+            ActivationImpl<ActivationFunction::Linear>(inData, outData, numElements, a, b);
+            break;
+        case ActivationFunction::ReLu:
+            ActivationImpl<ActivationFunction::ReLu>(inData, outData, numElements, a, b);
+            break;
+        case ActivationFunction::BoundedReLu:
+            ActivationImpl<ActivationFunction::BoundedReLu>(inData, outData, numElements, a, b);
+            break;
+        case ActivationFunction::LeakyReLu:
+            ActivationImpl<ActivationFunction::LeakyReLu>(inData, outData, numElements, a, b);
+            break;
+        case ActivationFunction::Abs:
+            ActivationImpl<ActivationFunction::Abs>(inData, outData, numElements, a, b);
+            break;
+        case ActivationFunction::Square:
+            ActivationImpl<ActivationFunction::Square>(inData, outData, numElements, a, b);
+            break;
+        default:
+            for (unsigned int i = 0; i < numElements; i++)
+            {
+                outData[i] = Activation(inData[i], function, a, b);
+            }
+            break;
+    }
+}
+
+void ActivationImpl(QASymm8Decoder& in,
+                    QASymm8Encoder& out,
+                    unsigned int numElements,
+                    ActivationFunction function,
+                    float a,
+                    float b)
+{
+    // There are only 256 possible inputs, so the quantized result for each of them is computed once, through
+    // copies of the iterators to get the same rounding as the generic path, and looked up for every element.
+    constexpr unsigned int numValues = 256;
+    if (numElements < numValues)
+    {
+        ActivationImpl<QASymm8Decoder, QASymm8Encoder>(in, out, numElements, function, a, b);
+        return;
+    }
+
+    std::array<uint8_t, numValues> values;
+    std::array<uint8_t, numValues> table;
+    for (unsigned int i = 0; i < numValues; i++)
+    {
+        values[i] = static_cast<uint8_t>(i);
+    }
+
+    QASymm8Decoder valueDecoder(in);
+    QASymm8Encoder tableEncoder(out);
+    valueDecoder.Reset(values.data());
+    tableEncoder.Reset(table.data());
+    ActivationImpl<QASymm8Decoder, QASymm8Encoder>(valueDecoder, tableEncoder, numValues, function, a, b);
+
+    const uint8_t* inData = in.GetPointer();
+    uint8_t* outData = out.GetPointer();
+    for (unsigned int i = 0; i < numElements; i++)
+    {
+        outData[i] = table[inData[i]];
+    }
+}
+
+} // anonymous namespace
+
+void Activation(Decoder<float>& in,
+                Encoder<float>& out,
+                const TensorInfo& tensorInfo,
+                ActivationFunction function,
+                float a,
+                float b)
+{
+    unsigned int numElements = tensorInfo.GetNumElements();
+
+    DispatchTypedIterators(in, out, [&](auto& typedIn, auto& typedOut)
+    {
+        ActivationImpl(typedIn, typedOut, numElements, function, a, b);
+    });
+}
+
 } //namespace armnn
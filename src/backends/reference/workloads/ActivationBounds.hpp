@@ -0,0 +1,56 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Exceptions.hpp>
+#include <armnn/Optional.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace armnn
+{
+
+/// The range a layer clamps its outputs to as it stores them, which applies the ReLu or BoundedReLu activation fused
+/// into the layer. The default range is unbounded, so clamping to it leaves the outputs unchanged.
+struct ActivationBounds
+{
+    float Clamp(float value) const
+    {
+        return std::min(std::max(value, m_Min), m_Max);
+    }
+
+    float m_Min = -std::numeric_limits<float>::infinity();
+    float m_Max = std::numeric_limits<float>::infinity();
+};
+
+/// Returns the range of the activation fused into a layer, or the unbounded range if there is none.
+inline ActivationBounds GetActivationBounds(const Optional<ActivationDescriptor>& fusedActivation)
+{
+    ActivationBounds bounds;
+    if (!fusedActivation.has_value())
+    {
+        return bounds;
+    }
+
+    const ActivationDescriptor& descriptor = fusedActivation.value();
+    switch (descriptor.m_Function)
+    {
+        case ActivationFunction::ReLu:
+            bounds.m_Min = 0.0f;
+            break;
+        case ActivationFunction::BoundedReLu:
+            bounds.m_Min = descriptor.m_B;
+            bounds.m_Max = descriptor.m_A;
+            break;
+        default:
+            throw InvalidArgumentException("Only ReLu and BoundedReLu activations can be fused into a layer");
+    }
+    return bounds;
+}
+
+} // namespace armnn
@@ -13,6 +13,8 @@
 #include <boost/assert.hpp>
 #include <boost/core/ignore_unused.hpp>
 
+#include <memory>
+
 namespace armnn
 {
 
@@ -45,6 +47,10 @@ public:
     virtual void Reset(void*) = 0;
 
     virtual IType Get() const = 0;
+
+    /// Returns a copy of this decoder, reading the same data from the same position, which can be used
+    /// independently of it (e.g. from another thread).
+    virtual std::unique_ptr<Decoder<IType>> Clone() const = 0;
 };
 
 template<typename IType>
@@ -60,6 +66,10 @@ public:
     virtual void Set(IType right) = 0;
 
     virtual IType Get() const = 0;
+
+    /// Returns a copy of this encoder, writing to the same data from the same position, which can be used
+    /// independently of it (e.g. from another thread).
+    virtual std::unique_ptr<Encoder<IType>> Clone() const = 0;
 };
 
 template<typename T, typename Base>
@@ -112,12 +122,19 @@ public:
         return *this;
     }
 
+    /// Returns a pointer to the element at the current position, so that kernels can work directly on
+    /// contiguous data of a known type.
+    T* GetPointer() const
+    {
+        return m_Iterator;
+    }
+
 protected:
     T* m_Iterator;
     T* m_Start;
 };
 
-class QASymm8Decoder : public TypedIterator<const uint8_t, Decoder<float>>
+class QASymm8Decoder final : public TypedIterator<const uint8_t, Decoder<float>>
 {
 public:
     QASymm8Decoder(const uint8_t* data, const float scale, const int32_t offset)
@@ -131,12 +148,27 @@ public:
         return armnn::Dequantize(*m_Iterator, m_Scale, m_Offset);
     }
 
+    std::unique_ptr<Decoder<float>> Clone() const override
+    {
+        return std::make_unique<QASymm8Decoder>(*this);
+    }
+
+    float GetScale() const
+    {
+        return m_Scale;
+    }
+
+    int32_t GetOffset() const
+    {
+        return m_Offset;
+    }
+
 private:
     const float m_Scale;
     const int32_t m_Offset;
 };
 
-class QSymm16Decoder : public TypedIterator<const int16_t, Decoder<float>>
+class QSymm16Decoder final : public TypedIterator<const int16_t, Decoder<float>>
 {
 public:
     QSymm16Decoder(const int16_t* data, const float scale, const int32_t offset)
@@ -150,12 +182,17 @@ public:
         return armnn::Dequantize(*m_Iterator, m_Scale, m_Offset);
     }
 
+    std::unique_ptr<Decoder<float>> Clone() const override
+    {
+        return std::make_unique<QSymm16Decoder>(*this);
+    }
+
 private:
     const float m_Scale;
     const int32_t m_Offset;
 };
 
-class Float16Decoder : public TypedIterator<const Half, Decoder<float>>
+class Float16Decoder final : public TypedIterator<const Half, Decoder<float>>
 {
 public:
     Float16Decoder(const Half* data)
@@ -170,9 +207,14 @@ public:
         armnnUtils::FloatingPointConverter::ConvertFloat16To32(m_Iterator, 1, &val);
         return val;
     }
+
+    std::unique_ptr<Decoder<float>> Clone() const override
+    {
+        return std::make_unique<Float16Decoder>(*this);
+    }
 };
 
-class Float32Decoder : public TypedIterator<const float, Decoder<float>>
+class Float32Decoder final : public TypedIterator<const float, Decoder<float>>
 {
 public:
     Float32Decoder(const float* data)
@@ -185,9 +227,14 @@ public:
     {
         return *m_Iterator;
     }
+
+    std::unique_ptr<Decoder<float>> Clone() const override
+    {
+        return std::make_unique<Float32Decoder>(*this);
+    }
 };
 
-class ScaledInt32Decoder : public TypedIterator<const int32_t, Decoder<float>>
+class ScaledInt32Decoder final : public TypedIterator<const int32_t, Decoder<float>>
 {
 public:
     ScaledInt32Decoder(const int32_t* data, const float scale)
@@ -201,11 +248,21 @@ public:
         return static_cast<float>(*m_Iterator) * m_Scale;
     }
 
+    std::unique_ptr<Decoder<float>> Clone() const override
+    {
+        return std::make_unique<ScaledInt32Decoder>(*this);
+    }
+
+    float GetScale() const
+    {
+        return m_Scale;
+    }
+
 private:
     const float m_Scale;
 };
 
-class Int32Decoder : public TypedIterator<const int32_t, Decoder<float>>
+class Int32Decoder final : public TypedIterator<const int32_t, Decoder<float>>
 {
 public:
     Int32Decoder(const int32_t* data)
@@ -218,9 +275,14 @@ public:
     {
         return static_cast<float>(*m_Iterator);
     }
+
+    std::unique_ptr<Decoder<float>> Clone() const override
+    {
+        return std::make_unique<Int32Decoder>(*this);
+    }
 };
 
-class QASymm8Encoder : public TypedIterator<uint8_t, Encoder<float>>
+class QASymm8Encoder final : public TypedIterator<uint8_t, Encoder<float>>
 {
 public:
     QASymm8Encoder(uint8_t* data, const float scale, const int32_t offset)
@@ -239,12 +301,27 @@ public:
         return armnn::Dequantize(*m_Iterator, m_Scale, m_Offset);
     }
 
+    std::unique_ptr<Encoder<float>> Clone() const override
+    {
+        return std::make_unique<QASymm8Encoder>(*this);
+    }
+
+    float GetScale() const
+    {
+        return m_Scale;
+    }
+
+    int32_t GetOffset() const
+    {
+        return m_Offset;
+    }
+
 private:
     const float m_Scale;
     const int32_t m_Offset;
 };
 
-class QSymm16Encoder : public TypedIterator<int16_t, Encoder<float>>
+class QSymm16Encoder final : public TypedIterator<int16_t, Encoder<float>>
 {
 public:
     QSymm16Encoder(int16_t* data, const float scale, const int32_t offset)
@@ -263,12 +340,17 @@ public:
         return armnn::Dequantize(*m_Iterator, m_Scale, m_Offset);
     }
 
+    std::unique_ptr<Encoder<float>> Clone() const override
+    {
+        return std::make_unique<QSymm16Encoder>(*this);
+    }
+
 private:
     const float m_Scale;
     const int32_t m_Offset;
 };
 
-class Float16Encoder : public TypedIterator<Half, Encoder<float>>
+class Float16Encoder final : public TypedIterator<Half, Encoder<float>>
 {
 public:
     Float16Encoder(Half* data)
@@ -288,9 +370,14 @@ public:
         armnnUtils::FloatingPointConverter::ConvertFloat16To32(m_Iterator, 1, &val);
         return val;
     }
+
+    std::unique_ptr<Encoder<float>> Clone() const override
+    {
+        return std::make_unique<Float16Encoder>(*this);
+    }
 };
 
-class Float32Encoder : public TypedIterator<float, Encoder<float>>
+class Float32Encoder final : public TypedIterator<float, Encoder<float>>
 {
 public:
     Float32Encoder(float* data)
@@ -308,9 +395,14 @@ public:
     {
         return *m_Iterator;
     }
+
+    std::unique_ptr<Encoder<float>> Clone() const override
+    {
+        return std::make_unique<Float32Encoder>(*this);
+    }
 };
 
-class Int32Encoder : public TypedIterator<int32_t, Encoder<float>>
+class Int32Encoder final : public TypedIterator<int32_t, Encoder<float>>
 {
 public:
     Int32Encoder(int32_t* data)
@@ -328,9 +420,14 @@ public:
     {
         return static_cast<float>(*m_Iterator);
     }
+
+    std::unique_ptr<Encoder<float>> Clone() const override
+    {
+        return std::make_unique<Int32Encoder>(*this);
+    }
 };
 
-class BooleanEncoder : public TypedIterator<uint8_t, Encoder<bool>>
+class BooleanEncoder final : public TypedIterator<uint8_t, Encoder<bool>>
 {
 public:
     BooleanEncoder(uint8_t* data)
@@ -348,6 +445,11 @@ public:
     {
         return *m_Iterator;
     }
+
+    std::unique_ptr<Encoder<bool>> Clone() const override
+    {
+        return std::make_unique<BooleanEncoder>(*this);
+    }
 };
 
 // PerAxisIterator for per-axis quantization
@@ -415,7 +517,7 @@ public:
         unsigned int m_AxisFactor;
 };
 
-class QSymm8PerAxisDecoder : public PerAxisIterator<const int8_t, Decoder<float>>
+class QSymm8PerAxisDecoder final : public PerAxisIterator<const int8_t, Decoder<float>>
 {
 public:
     QSymm8PerAxisDecoder(const int8_t* data, const std::vector<float>& scale, unsigned int axisFactor)
@@ -432,11 +534,16 @@ public:
         return m_Scale[m_AxisIndex];
     }
 
+    std::unique_ptr<Decoder<float>> Clone() const override
+    {
+        return std::make_unique<QSymm8PerAxisDecoder>(*this);
+    }
+
 private:
     std::vector<float> m_Scale;
 };
 
-class QSymm8PerAxisEncoder : public PerAxisIterator<int8_t, Encoder<float>>
+class QSymm8PerAxisEncoder final : public PerAxisIterator<int8_t, Encoder<float>>
 {
 public:
     QSymm8PerAxisEncoder(int8_t* data, const std::vector<float>& scale, unsigned int axisFactor)
@@ -458,11 +565,16 @@ public:
         return m_Scale[m_AxisIndex];
     }
 
+    std::unique_ptr<Encoder<float>> Clone() const override
+    {
+        return std::make_unique<QSymm8PerAxisEncoder>(*this);
+    }
+
 private:
     std::vector<float> m_Scale;
 };
 
-class ScaledInt32PerAxisDecoder : public PerAxisIterator<const int32_t, Decoder<float>>
+class ScaledInt32PerAxisDecoder final : public PerAxisIterator<const int32_t, Decoder<float>>
 {
 public:
     ScaledInt32PerAxisDecoder(const int32_t* data, const std::vector<float>& scales, unsigned int axisFactor)
@@ -479,6 +591,11 @@ public:
         return m_Scales[m_AxisIndex];
     }
 
+    std::unique_ptr<Decoder<float>> Clone() const override
+    {
+        return std::make_unique<ScaledInt32PerAxisDecoder>(*this);
+    }
+
 private:
     std::vector<float> m_Scales;
 };
@@ -16,6 +16,7 @@ namespace armnn
 {
 
 void BatchNormImpl(const BatchNormalizationQueueDescriptor& data,
+                   const TensorInfo& inputInfo,
                    Decoder<float>& meanDecoder,
                    Decoder<float>& varianceDecoder,
                    Decoder<float>& betaDecoder,
@@ -23,7 +24,6 @@ void BatchNormImpl(const BatchNormalizationQueueDescriptor& data,
                    Decoder<float>& inputDecoder,
                    Encoder<float>& outputEncoder)
 {
-    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
     const TensorShape inputShape = inputInfo.GetShape();
 
     armnnUtils::DataLayoutIndexed dataLayout(data.m_Parameters.m_DataLayout);
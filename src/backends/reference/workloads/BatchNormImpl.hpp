@@ -14,6 +14,7 @@ namespace armnn
 {
 
 void BatchNormImpl(const BatchNormalizationQueueDescriptor& data,
+                   const TensorInfo& inputInfo,
                    Decoder<float>& meanIn,
                    Decoder<float>& varIn,
                    Decoder<float>& betaIn,
@@ -10,5 +10,7 @@
 
 namespace armnn
 {
-void Concatenate(const ConcatQueueDescriptor &data);
+void Concatenate(const ConcatQueueDescriptor &data,
+                 const std::vector<ITensorHandle*>& inputs,
+                 const std::vector<ITensorHandle*>& outputs);
 } //namespace armnn
@@ -0,0 +1,407 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ConvGemm.hpp"
+#include "IteratorDispatch.hpp"
+#include "QuantizedArithmetic.hpp"
+
+#include <DataLayoutIndexed.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace armnn
+{
+
+namespace
+{
+
+// Number of output positions lowered and multiplied together, i.e. the rows of a patch matrix.
+constexpr unsigned int g_TileRows = 8;
+
+// Number of output channels accumulated together. A tile's accumulators for one block of channels fit in L1.
+constexpr unsigned int g_BlockChannels = 64;
+
+} // anonymous namespace
+
+bool IsGemmConvolutionPreferred(const TensorShape& rOutputShape, DataLayout dataLayout)
+{
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
+    const unsigned int outputChannels     = rOutputShape[dataLayoutIndexed.GetChannelsIndex()];
+    const unsigned int numOutputPositions = rOutputShape[0] *
+                                            rOutputShape[dataLayoutIndexed.GetHeightIndex()] *
+                                            rOutputShape[dataLayoutIndexed.GetWidthIndex()];
+
+    // Packing the filter costs about as much as computing one output position directly, and the multiplication
+    // kernel only pays off with enough output channels to keep its inner loop busy.
+    return numOutputPositions >= g_TileRows && outputChannels >= 4;
+}
+
+void ConvolveGemm(RefThreadPool& threadPool,
+                  const TensorShape& rInputShape,
+                  Decoder<float>& rInputDecoder,
+                  const TensorShape& rOutputShape,
+                  Encoder<float>& rOutputEncoder,
+                  const TensorShape& rFilterShape,
+                  Decoder<float>& rFilterDecoder,
+                  bool biasEnabled,
+                  Decoder<float>* pBiasDecoder,
+                  DataLayout dataLayout,
+                  unsigned int paddingTop,
+                  unsigned int paddingLeft,
+                  unsigned int xStride,
+                  unsigned int yStride,
+                  unsigned int xDilation,
+                  unsigned int yDilation,
+                  bool depthwise)
+{
+    if (biasEnabled && !pBiasDecoder)
+    {
+        throw InvalidArgumentException("Bias is enabled but the bias data is invalid");
+    }
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
+
+    const unsigned int channelsIndex = dataLayoutIndexed.GetChannelsIndex();
+    const unsigned int heightIndex   = dataLayoutIndexed.GetHeightIndex();
+    const unsigned int widthIndex    = dataLayoutIndexed.GetWidthIndex();
+
+    const unsigned int depthMultiplier = depthwise ? rFilterShape[0] : 1;
+    const unsigned int inputChannels   = depthwise ? rFilterShape[1] : rFilterShape[channelsIndex];
+    const unsigned int outputChannels  = depthwise ? inputChannels * depthMultiplier : rFilterShape[0];
+
+    const unsigned int batchSize    = rOutputShape[0];
+    const unsigned int outputHeight = rOutputShape[heightIndex];
+    const unsigned int outputWidth  = rOutputShape[widthIndex];
+    const unsigned int inputHeight  = rInputShape[heightIndex];
+    const unsigned int inputWidth   = rInputShape[widthIndex];
+
+    const unsigned int filterHeight = depthwise ? rFilterShape[2] : rFilterShape[heightIndex];
+    const unsigned int filterWidth  = depthwise ? rFilterShape[3] : rFilterShape[widthIndex];
+
+    // Number of products summed into each output element. They are numbered by input channel, then filter row,
+    // then filter column, which is the order the direct convolution adds them in.
+    const unsigned int patchSize = (depthwise ? 1 : inputChannels) * filterHeight * filterWidth;
+
+    auto getInputIndex = [&](unsigned int batchIdx, unsigned int channel, unsigned int y, unsigned int x)
+    {
+        // Keep this implementation, as using DataLayoutIndexed::GetIndex causes great performance regression.
+        if (dataLayout == DataLayout::NHWC)
+        {
+            return ((batchIdx * inputHeight + y) * inputWidth + x) * inputChannels + channel;
+        }
+        return ((batchIdx * inputChannels + channel) * inputHeight + y) * inputWidth + x;
+    };
+
+    // Packs the filter as a [patchSize x outputChannels] matrix, so the inner loop of the multiplication reads
+    // consecutive output channels. getWeight(filterIndex, cOutput) returns the value of a filter element.
+    auto packFilter = [&](auto& packedFilter, auto getWeight)
+    {
+        packedFilter.resize(patchSize * outputChannels);
+        for (unsigned int cOutput = 0; cOutput < outputChannels; ++cOutput)
+        {
+            for (unsigned int cInput = 0; cInput < (depthwise ? 1 : inputChannels); ++cInput)
+            {
+                for (unsigned int yFilter = 0; yFilter < filterHeight; ++yFilter)
+                {
+                    for (unsigned int xFilter = 0; xFilter < filterWidth; ++xFilter)
+                    {
+                        unsigned int filterIndex = 0;
+                        if (depthwise)
+                        {
+                            filterIndex = (cOutput % depthMultiplier) * filterWidth * filterHeight * inputChannels +
+                                          (cOutput / depthMultiplier) * filterWidth * filterHeight +
+                                          yFilter * filterWidth +
+                                          xFilter;
+                        }
+                        else if (dataLayout == DataLayout::NHWC)
+                        {
+                            filterIndex = cOutput * filterHeight * filterWidth * inputChannels +
+                                          yFilter * filterWidth * inputChannels +
+                                          xFilter * inputChannels +
+                                          cInput;
+                        }
+                        else
+                        {
+                            filterIndex = cOutput * filterWidth * filterHeight * inputChannels +
+                                          cInput  * filterWidth * filterHeight +
+                                          yFilter * filterWidth +
+                                          xFilter;
+                        }
+
+                        const unsigned int k = (cInput * filterHeight + yFilter) * filterWidth + xFilter;
+                        packedFilter[k * outputChannels + cOutput] = getWeight(filterIndex, cOutput);
+                    }
+                }
+            }
+        }
+    };
+
+    const unsigned int numPositions = batchSize * outputHeight * outputWidth;
+    const unsigned int numTiles = (numPositions + g_TileRows - 1) / g_TileRows;
+
+    // Processes the output positions [beginTile * g_TileRows, endTile * g_TileRows). getInput(inputIndex) returns
+    // the value of an input element, which is read while lowering the patches. The products are accumulated in the
+    // type of the filter values, float or int32, and each sum is passed to storeOutput(outputIndex, sum) with the
+    // bias, which is null if disabled.
+    auto convolveTiles = [&](auto&& getInput,
+                             const auto* packedFilter,
+                             const auto* biases,
+                             auto&& storeOutput,
+                             unsigned int beginTile,
+                             unsigned int endTile)
+    {
+        using Accumulator = std::decay_t<decltype(*packedFilter)>;
+
+        std::vector<Accumulator> patches(depthwise ? 0 : g_TileRows * patchSize);
+        Accumulator accumulators[g_TileRows * g_BlockChannels];
+        Accumulator channelInputs[g_BlockChannels];
+
+        for (unsigned int tile = beginTile; tile < endTile; ++tile)
+        {
+            const unsigned int firstPosition = tile * g_TileRows;
+            const unsigned int numRows = std::min(g_TileRows, numPositions - firstPosition);
+
+            unsigned int batchIndices[g_TileRows];
+            unsigned int yOutputs[g_TileRows];
+            unsigned int xOutputs[g_TileRows];
+            for (unsigned int row = 0; row < numRows; ++row)
+            {
+                const unsigned int position = firstPosition + row;
+                batchIndices[row] = position / (outputHeight * outputWidth);
+                yOutputs[row]     = (position / outputWidth) % outputHeight;
+                xOutputs[row]     = position % outputWidth;
+            }
+
+            // Returns whether the input element under filter element (yFilter, xFilter) for the output position
+            // of the row is in the padding, and its coordinates in the unpadded input if not.
+            auto getInputCoordinates = [&](unsigned int row,
+                                           unsigned int yFilter,
+                                           unsigned int xFilter,
+                                           unsigned int& yInput,
+                                           unsigned int& xInput)
+            {
+                yInput = yOutputs[row] * yStride + yFilter * yDilation;
+                xInput = xOutputs[row] * xStride + xFilter * xDilation;
+                if (yInput < paddingTop || yInput >= inputHeight + paddingTop ||
+                    xInput < paddingLeft || xInput >= inputWidth + paddingLeft)
+                {
+                    return false;
+                }
+                yInput -= paddingTop;
+                xInput -= paddingLeft;
+                return true;
+            };
+
+            // Lowers the tile's input patches to rows of the patch matrix.
+            if (!depthwise)
+            {
+                for (unsigned int row = 0; row < numRows; ++row)
+                {
+                    Accumulator* patch = &patches[row * patchSize];
+                    for (unsigned int cInput = 0; cInput < inputChannels; ++cInput)
+                    {
+                        for (unsigned int yFilter = 0; yFilter < filterHeight; ++yFilter)
+                        {
+                            for (unsigned int xFilter = 0; xFilter < filterWidth; ++xFilter)
+                            {
+                                unsigned int yInput;
+                                unsigned int xInput;
+                                *patch++ = getInputCoordinates(row, yFilter, xFilter, yInput, xInput) ?
+                                           getInput(getInputIndex(batchIndices[row], cInput, yInput, xInput)) :
+                                           Accumulator(0);
+                            }
+                        }
+                    }
+                }
+            }
+
+            for (unsigned int firstChannel = 0; firstChannel < outputChannels; firstChannel += g_BlockChannels)
+            {
+                const unsigned int numChannels = std::min(g_BlockChannels, outputChannels - firstChannel);
+                std::fill_n(accumulators, g_TileRows * g_BlockChannels, Accumulator(0));
+
+                if (!depthwise)
+                {
+                    for (unsigned int k = 0; k < patchSize; ++k)
+                    {
+                        const Accumulator* filterRow = &packedFilter[k * outputChannels + firstChannel];
+                        for (unsigned int row = 0; row < numRows; ++row)
+                        {
+                            const Accumulator inputValue = patches[row * patchSize + k];
+                            Accumulator* rowAccumulators = &accumulators[row * g_BlockChannels];
+                            for (unsigned int c = 0; c < numChannels; ++c)
+                            {
+                                rowAccumulators[c] += inputValue * filterRow[c];
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    // Each output channel reads a single input channel, so the channels are gathered for each
+                    // filter element instead of building a patch matrix.
+                    for (unsigned int row = 0; row < numRows; ++row)
+                    {
+                        Accumulator* rowAccumulators = &accumulators[row * g_BlockChannels];
+                        for (unsigned int k = 0; k < patchSize; ++k)
+                        {
+                            unsigned int yInput;
+                            unsigned int xInput;
+                            if (getInputCoordinates(row, k / filterWidth, k % filterWidth, yInput, xInput))
+                            {
+                                for (unsigned int c = 0; c < numChannels; ++c)
+                                {
+                                    const unsigned int cInput = (firstChannel + c) / depthMultiplier;
+                                    channelInputs[c] =
+                                        getInput(getInputIndex(batchIndices[row], cInput, yInput, xInput));
+                                }
+                            }
+                            else
+                            {
+                                std::fill_n(channelInputs, numChannels, Accumulator(0));
+                            }
+
+                            const Accumulator* filterRow = &packedFilter[k * outputChannels + firstChannel];
+                            for (unsigned int c = 0; c < numChannels; ++c)
+                            {
+                                rowAccumulators[c] += channelInputs[c] * filterRow[c];
+                            }
+                        }
+                    }
+                }
+
+                for (unsigned int row = 0; row < numRows; ++row)
+                {
+                    for (unsigned int c = 0; c < numChannels; ++c)
+                    {
+                        const unsigned int cOutput = firstChannel + c;
+                        Accumulator sum = accumulators[row * g_BlockChannels + c];
+                        if (biases)
+                        {
+                            sum += biases[cOutput];
+                        }
+
+                        storeOutput(dataLayoutIndexed.GetIndex(rOutputShape, batchIndices[row], cOutput,
+                                                               yOutputs[row], xOutputs[row]), sum);
+                    }
+                }
+            }
+        }
+    };
+
+    const unsigned int macsPerTile = g_TileRows * patchSize * outputChannels;
+    const unsigned int tilesPerRange = std::max(1u, g_MinMacsPerParallelRange / std::max(1u, macsPerTile));
+
+    // QAsymm8 convolutions whose output can be requantized with an integer multiplier subtract the offsets from
+    // the inputs and weights and accumulate their products in int32, like the kernels of the other backends.
+    const Optional<QuantizedProductParams> quantizedParams =
+        GetQuantizedProductParams(rInputDecoder, rFilterDecoder, biasEnabled ? pBiasDecoder : nullptr,
+                                  rOutputEncoder, patchSize);
+    if (quantizedParams.has_value())
+    {
+        const QuantizedProductParams& params = quantizedParams.value();
+
+        // The input offset is subtracted while lowering the patches, so padding reads as the input zero point.
+        auto& quantizedInput = static_cast<QASymm8Decoder&>(rInputDecoder);
+        quantizedInput.SetIndex(0);
+        const uint8_t* input = quantizedInput.GetPointer();
+        auto getInput = [input, &params](unsigned int inputIndex)
+        {
+            return static_cast<int32_t>(input[inputIndex]) - params.m_InputOffset;
+        };
+
+        auto& quantizedFilter = static_cast<QASymm8Decoder&>(rFilterDecoder);
+        quantizedFilter.SetIndex(0);
+        std::vector<int32_t> packedFilter;
+        packFilter(packedFilter, [&](unsigned int filterIndex, unsigned int)
+        {
+            return static_cast<int32_t>(quantizedFilter.GetPointer()[filterIndex]) - params.m_WeightOffset;
+        });
+
+        const int32_t* biases = nullptr;
+        if (biasEnabled)
+        {
+            auto& quantizedBias = static_cast<ScaledInt32Decoder&>(*pBiasDecoder);
+            quantizedBias.SetIndex(0);
+            biases = quantizedBias.GetPointer();
+        }
+
+        auto& quantizedOutput = static_cast<QASymm8Encoder&>(rOutputEncoder);
+        quantizedOutput.SetIndex(0);
+        uint8_t* output = quantizedOutput.GetPointer();
+
+        threadPool.ParallelFor(numTiles, tilesPerRange, [&](unsigned int begin, unsigned int end)
+        {
+            convolveTiles(getInput, packedFilter.data(), biases, [&](unsigned int outputIndex, int32_t sum)
+            {
+                output[outputIndex] = Requantize(sum, params.m_OutputMultiplier, params.m_OutputOffset);
+            }, begin, end);
+        });
+        return;
+    }
+
+    // Float32 inputs are read in place, others are decoded once rather than once per product.
+    std::vector<float> decodedInput;
+    const float* input = nullptr;
+    if (auto float32Input = dynamic_cast<Float32Decoder*>(&rInputDecoder))
+    {
+        float32Input->SetIndex(0);
+        input = float32Input->GetPointer();
+    }
+    else
+    {
+        decodedInput.resize(rInputShape.GetNumElements());
+        for (unsigned int i = 0; i < decodedInput.size(); ++i)
+        {
+            rInputDecoder[i];
+            decodedInput[i] = rInputDecoder.Get();
+        }
+        input = decodedInput.data();
+    }
+
+    std::vector<float> packedFilter;
+    packFilter(packedFilter, [&](unsigned int filterIndex, unsigned int cOutput)
+    {
+        rFilterDecoder.SetIndex(filterIndex, cOutput);
+        return rFilterDecoder.Get();
+    });
+
+    std::vector<float> biases;
+    if (biasEnabled)
+    {
+        biases.resize(outputChannels);
+        for (unsigned int cOutput = 0; cOutput < outputChannels; ++cOutput)
+        {
+            pBiasDecoder->SetIndex(cOutput, cOutput);
+            biases[cOutput] = pBiasDecoder->Get();
+        }
+    }
+
+    // The encoder keeps its position, so each range writes through its own copy. They are all made before the ranges
+    // start, while nothing moves the original.
+    const unsigned int numRanges = threadPool.GetNumRanges(numTiles, tilesPerRange);
+    std::vector<std::unique_ptr<Encoder<float>>> outputEncoders;
+    for (unsigned int range = 0; range < numRanges; ++range)
+    {
+        outputEncoders.push_back(CopyIterator(rOutputEncoder));
+    }
+
+    threadPool.ParallelForEachRange(numTiles, numRanges, [&](unsigned int range, unsigned int begin, unsigned int end)
+    {
+        Encoder<float>& outputEncoder = *outputEncoders[range];
+
+        convolveTiles([input](unsigned int inputIndex) { return input[inputIndex]; },
+                      packedFilter.data(), biasEnabled ? biases.data() : nullptr,
+                      [&](unsigned int outputIndex, float sum)
+                      {
+                          outputEncoder[outputIndex];
+                          outputEncoder.Set(sum);
+                      }, begin, end);
+    });
+}
+
+} // namespace armnn
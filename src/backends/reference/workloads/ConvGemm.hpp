@@ -0,0 +1,46 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "BaseIterator.hpp"
+#include "RefThreadPool.hpp"
+
+#include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
+
+namespace armnn
+{
+
+/// Returns whether ConvolveGemm() is expected to be faster than the direct convolution for these shapes.
+bool IsGemmConvolutionPreferred(const TensorShape& rOutputShape, DataLayout dataLayout);
+
+/// Computes a convolution as a matrix multiplication. The filter is decoded once into a [K x M] matrix, where K
+/// is the number of input elements each output element depends on and M the number of output channels. The input
+/// is lowered to [tile x K] patch matrices (im2col) one tile of output positions at a time, which keeps the extra
+/// memory small, and multiplied with the filter by a cache-blocked kernel whose inner loop runs over contiguous
+/// output channels. Each output element accumulates its products in the same order as the direct convolution,
+/// so the results are the same. QAsymm8 convolutions whose bias is Signed32 and whose output multiplier is smaller
+/// than one are computed with int32 accumulators and requantized with QuantizedMultiplierSmallerThanOne instead.
+/// The tiles are split across the threads of threadPool.
+void ConvolveGemm(RefThreadPool& threadPool,
+                  const TensorShape& rInputShape,
+                  Decoder<float>& rInputDecoder,
+                  const TensorShape& rOutputShape,
+                  Encoder<float>& rOutputEncoder,
+                  const TensorShape& rFilterShape,
+                  Decoder<float>& rFilterDecoder,
+                  bool biasEnabled,
+                  Decoder<float>* pBiasDecoder,
+                  DataLayout dataLayout,
+                  unsigned int paddingTop,
+                  unsigned int paddingLeft,
+                  unsigned int xStride,
+                  unsigned int yStride,
+                  unsigned int xDilation,
+                  unsigned int yDilation,
+                  bool depthwise);
+
+} // namespace armnn
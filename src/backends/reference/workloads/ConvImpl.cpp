@@ -4,11 +4,17 @@
 //
 
 #include "ConvImpl.hpp"
+#include "ConvGemm.hpp"
+#include "IteratorDispatch.hpp"
+#include "QuantizedArithmetic.hpp"
+#include "RefThreadPool.hpp"
 
 #include <boost/assert.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <vector>
 
 namespace armnn
 {
@@ -68,27 +74,27 @@ int32_t QuantizedMultiplierSmallerThanOne::RoundingDivideByPOT(int32_t x, int ex
     return (x >> exponent) + (remainder > threshold ? 1 : 0);
 }
 
-void Convolve(const TensorShape& rInputShape,
-              Decoder<float>& rInputDecoder,
-              const TensorShape& rOutputShape,
-              Encoder<float>& rOutputEncoder,
-              const TensorShape& rFilterShape,
-              Decoder<float>& rFilterDecoder,
-              bool biasEnabled,
-              Decoder<float>* pBiasDecoder,
-              DataLayout dataLayout,
-              unsigned int paddingTop,
-              unsigned int paddingLeft,
-              unsigned int xStride,
-              unsigned int yStride,
-              unsigned int xDilation,
-              unsigned int yDilation,
-              bool depthwise)
+namespace
+{
+
+void ConvolveDirect(RefThreadPool& threadPool,
+                    const TensorShape& rInputShape,
+                    Decoder<float>& rInputDecoder,
+                    const TensorShape& rOutputShape,
+                    Encoder<float>& rOutputEncoder,
+                    const TensorShape& rFilterShape,
+                    Decoder<float>& rFilterDecoder,
+                    bool biasEnabled,
+                    Decoder<float>* pBiasDecoder,
+                    DataLayout dataLayout,
+                    unsigned int paddingTop,
+                    unsigned int paddingLeft,
+                    unsigned int xStride,
+                    unsigned int yStride,
+                    unsigned int xDilation,
+                    unsigned int yDilation,
+                    bool depthwise)
 {
-    if (biasEnabled && !pBiasDecoder)
-    {
-        throw InvalidArgumentException("Bias is enabled but the bias data is invalid");
-    }
     const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
 
     const unsigned int channelsIndex = dataLayoutIndexed.GetChannelsIndex();
@@ -108,121 +114,233 @@ void Convolve(const TensorShape& rInputShape,
     unsigned int filterHeight = depthwise ? rFilterShape[2] : rFilterShape[heightIndex];
     unsigned int filterWidth  = depthwise ? rFilterShape[3] : rFilterShape[widthIndex];
 
-    for (unsigned int batchIdx = 0; batchIdx < batchSize; batchIdx++)
+    // Computes the output rows [begin, end), numbered across the batch, output channel and height dimensions.
+    // It is instantiated for the concrete iterator types when they are known, so that their calls are inlined.
+    auto convolveRows = [&](auto& rInputDecoder,
+                            auto& rOutputEncoder,
+                            auto& rFilterDecoder,
+                            auto* pBiasDecoder,
+                            unsigned int begin,
+                            unsigned int end)
     {
-        for (unsigned int cOutput = 0; cOutput < outputChannels; cOutput++)
+        for (unsigned int row = begin; row < end; row++)
         {
-            for (unsigned int yOutput = 0; yOutput < outputHeight; yOutput++)
+            const unsigned int batchIdx = row / (outputChannels * outputHeight);
+            const unsigned int cOutput  = (row / outputHeight) % outputChannels;
+            const unsigned int yOutput  = row % outputHeight;
+
+            for (unsigned int xOutput = 0; xOutput < outputWidth; xOutput++)
             {
-                for (unsigned int xOutput = 0; xOutput < outputWidth; xOutput++)
+                // This loop goes over each output element.
+                float sum =  0.0f;
+
+                // For depthwise, each output channel corresponds to exactly one input channel.
+                // For normal, must loop over each input channel.
+                for (unsigned int cInput = 0; cInput < (depthwise ? 1 : inputChannels); cInput++)
                 {
-                    // This loop goes over each output element.
-                    float sum =  0.0f;
+                    unsigned int depthwiseMultiplierIdx = 0;
+                    if (depthwise)
+                    {
+                        cInput = cOutput / depthMultiplier;
+                        depthwiseMultiplierIdx = cOutput % depthMultiplier;
+                    }
 
-                    // For depthwise, each output channel corresponds to exactly one input channel.
-                    // For normal, must loop over each input channel.
-                    for (unsigned int cInput = 0; cInput < (depthwise ? 1 : inputChannels); cInput++)
+                    for (unsigned int yFilter = 0; yFilter < filterHeight; yFilter++)
                     {
-                        unsigned int depthwiseMultiplierIdx = 0;
-                        if (depthwise)
+                        for (unsigned int xFilter = 0; xFilter < filterWidth; xFilter++)
                         {
-                            cInput = cOutput / depthMultiplier;
-                            depthwiseMultiplierIdx = cOutput % depthMultiplier;
-                        }
+                            // This loop goes over each input element for each output element.
+                            unsigned int filterIndex = 0;
 
-                        for (unsigned int yFilter = 0; yFilter < filterHeight; yFilter++)
-                        {
-                            for (unsigned int xFilter = 0; xFilter < filterWidth; xFilter++)
+                            // Since dimensionality of kernel depends on depthwiseness, so does index.
+                            if (depthwise)
                             {
-                                // This loop goes over each input element for each output element.
-                                unsigned int filterIndex = 0;
-
-                                // Since dimensionality of kernel depends on depthwiseness, so does index.
-                                if (depthwise)
+                                filterIndex = depthwiseMultiplierIdx * filterWidth * filterHeight * inputChannels +
+                                              cInput * filterWidth * filterHeight +
+                                              yFilter * filterWidth +
+                                              xFilter;
+                            }
+                            else
+                            {
+                                // Keep this implementation, as using DataLayoutIndexed::GetIndex causes great
+                                // performance regression.
+                                if (dataLayout == DataLayout::NHWC)
                                 {
-                                    filterIndex = depthwiseMultiplierIdx * filterWidth * filterHeight * inputChannels +
-                                                  cInput * filterWidth * filterHeight +
-                                                  yFilter * filterWidth +
-                                                  xFilter;
+                                    filterIndex = cOutput * filterHeight * filterWidth * inputChannels +
+                                                  yFilter * filterWidth * inputChannels +
+                                                  xFilter * inputChannels +
+                                                  cInput;
                                 }
                                 else
                                 {
-                                    // Keep this implementation, as using DataLayoutIndexed::GetIndex causes great
-                                    // performance regression.
-                                    if (dataLayout == DataLayout::NHWC)
-                                    {
-                                        filterIndex = cOutput * filterHeight * filterWidth * inputChannels +
-                                                      yFilter * filterWidth * inputChannels +
-                                                      xFilter * inputChannels +
-                                                      cInput;
-                                    }
-                                    else
-                                    {
-                                        filterIndex = cOutput * filterWidth * filterHeight * inputChannels +
-                                                      cInput  * filterWidth * filterHeight +
-                                                      yFilter * filterWidth +
-                                                      xFilter;
-                                    }
+                                    filterIndex = cOutput * filterWidth * filterHeight * inputChannels +
+                                                  cInput  * filterWidth * filterHeight +
+                                                  yFilter * filterWidth +
+                                                  xFilter;
                                 }
+                            }
+
+                            rFilterDecoder.SetIndex(filterIndex, cOutput);
+                            float filterValue = rFilterDecoder.Get();
 
-                                rFilterDecoder.SetIndex(filterIndex, cOutput);
-                                float filterValue = rFilterDecoder.Get();
+                            unsigned int yInput = yOutput * yStride + yFilter * yDilation;
+                            unsigned int xInput = xOutput * xStride + xFilter * xDilation;
 
-                                unsigned int yInput = yOutput * yStride + yFilter * yDilation;
-                                unsigned int xInput = xOutput * xStride + xFilter * xDilation;
+                            float inputValue;
 
-                                float inputValue;
+                            // Check if we're in the padding.
+                            if (yInput < paddingTop || yInput >= inputHeight + paddingTop ||
+                                xInput < paddingLeft || xInput >= inputWidth + paddingLeft )
+                            {
+                                inputValue = 0.0f;
+                            }
+                            else
+                            {
+                                unsigned int inputIndex = 0;
 
-                                // Check if we're in the padding.
-                                if (yInput < paddingTop || yInput >= inputHeight + paddingTop ||
-                                    xInput < paddingLeft || xInput >= inputWidth + paddingLeft )
+                                // Keep this implementation, as using DataLayoutIndexed::GetIndex causes great
+                                // performance regression.
+                                if (dataLayout == DataLayout::NHWC)
                                 {
-                                    inputValue = 0.0f;
+                                    inputIndex = batchIdx * inputHeight * inputWidth  * inputChannels +
+                                                 (yInput - paddingTop) * inputWidth * inputChannels +
+                                                 (xInput - paddingLeft) * inputChannels +
+                                                 cInput;
                                 }
                                 else
                                 {
-                                    unsigned int inputIndex = 0;
-
-                                    // Keep this implementation, as using DataLayoutIndexed::GetIndex causes great
-                                    // performance regression.
-                                    if (dataLayout == DataLayout::NHWC)
-                                    {
-                                        inputIndex = batchIdx * inputHeight * inputWidth  * inputChannels +
-                                                     (yInput - paddingTop) * inputWidth * inputChannels +
-                                                     (xInput - paddingLeft) * inputChannels +
-                                                     cInput;
-                                    }
-                                    else
-                                    {
-                                        inputIndex = batchIdx * inputWidth * inputHeight * inputChannels +
-                                                     inputWidth * inputHeight * cInput +
-                                                     inputWidth * (yInput - paddingTop) +
-                                                     xInput - paddingLeft;
-                                    }
-
-                                    rInputDecoder[inputIndex];
-                                    inputValue = rInputDecoder.Get();
+                                    inputIndex = batchIdx * inputWidth * inputHeight * inputChannels +
+                                                 inputWidth * inputHeight * cInput +
+                                                 inputWidth * (yInput - paddingTop) +
+                                                 xInput - paddingLeft;
                                 }
 
-                                sum += filterValue * inputValue;
+                                rInputDecoder[inputIndex];
+                                inputValue = rInputDecoder.Get();
                             }
+
+                            sum += filterValue * inputValue;
                         }
                     }
+                }
 
-                    if (biasEnabled)
-                    {
-                        (*pBiasDecoder).SetIndex(cOutput, cOutput);
-                        sum += pBiasDecoder->Get();
-                    }
+                if (biasEnabled)
+                {
+                    (*pBiasDecoder).SetIndex(cOutput, cOutput);
+                    sum += pBiasDecoder->Get();
+                }
 
-                    unsigned int outIdx = dataLayoutIndexed.GetIndex(rOutputShape, batchIdx, cOutput, yOutput, xOutput);
+                unsigned int outIdx = dataLayoutIndexed.GetIndex(rOutputShape, batchIdx, cOutput, yOutput, xOutput);
 
-                    rOutputEncoder[outIdx];
-                    rOutputEncoder.Set(sum);
-                }
+                rOutputEncoder[outIdx];
+                rOutputEncoder.Set(sum);
             }
         }
+    };
+
+    const unsigned int numRows = batchSize * outputChannels * outputHeight;
+
+    // The rows are independent, so they are shared out between the threads of the pool. Every output element is
+    // computed by a single thread in the same order as before, so the results don't depend on the thread count.
+    const unsigned int macsPerRow = outputWidth * filterHeight * filterWidth * (depthwise ? 1 : inputChannels);
+    const unsigned int rowsPerRange = std::max(1u, g_MinMacsPerParallelRange / std::max(1u, macsPerRow));
+
+    auto convolveParallel = [&](auto& inputDecoder, auto& outputEncoder, auto& filterDecoder, auto* biasDecoder)
+    {
+        const unsigned int numRanges = threadPool.GetNumRanges(numRows, rowsPerRange);
+        if (numRanges == 1)
+        {
+            convolveRows(inputDecoder, outputEncoder, filterDecoder, biasDecoder, 0, numRows);
+            return;
+        }
+
+        // The decoders and encoder keep their position, so each range works on its own copies. They are all made
+        // before the ranges start, while nothing moves the originals.
+        std::vector<decltype(CopyIterator(inputDecoder))> inputCopies;
+        std::vector<decltype(CopyIterator(outputEncoder))> outputCopies;
+        std::vector<decltype(CopyIterator(filterDecoder))> filterCopies;
+        std::vector<decltype(CopyIterator(*biasDecoder))> biasCopies;
+        for (unsigned int range = 0; range < numRanges; ++range)
+        {
+            inputCopies.push_back(CopyIterator(inputDecoder));
+            outputCopies.push_back(CopyIterator(outputEncoder));
+            filterCopies.push_back(CopyIterator(filterDecoder));
+            biasCopies.push_back(biasDecoder ? CopyIterator(*biasDecoder) : nullptr);
+        }
+
+        threadPool.ParallelForEachRange(numRows, numRanges,
+                                        [&](unsigned int range, unsigned int begin, unsigned int end)
+        {
+            convolveRows(*inputCopies[range], *outputCopies[range], *filterCopies[range], biasCopies[range].get(),
+                         begin, end);
+        });
+    };
+
+    auto float32Input  = dynamic_cast<Float32Decoder*>(&rInputDecoder);
+    auto float32Output = dynamic_cast<Float32Encoder*>(&rOutputEncoder);
+    auto float32Filter = dynamic_cast<Float32Decoder*>(&rFilterDecoder);
+    auto float32Bias   = dynamic_cast<Float32Decoder*>(pBiasDecoder);
+    if (float32Input && float32Output && float32Filter && (float32Bias || !pBiasDecoder))
+    {
+        convolveParallel(*float32Input, *float32Output, *float32Filter, float32Bias);
+        return;
+    }
+
+    auto qAsymm8Input  = dynamic_cast<QASymm8Decoder*>(&rInputDecoder);
+    auto qAsymm8Output = dynamic_cast<QASymm8Encoder*>(&rOutputEncoder);
+    auto qAsymm8Filter = dynamic_cast<QASymm8Decoder*>(&rFilterDecoder);
+    auto int32Bias     = dynamic_cast<ScaledInt32Decoder*>(pBiasDecoder);
+    if (qAsymm8Input && qAsymm8Output && qAsymm8Filter && (int32Bias || !pBiasDecoder))
+    {
+        convolveParallel(*qAsymm8Input, *qAsymm8Output, *qAsymm8Filter, int32Bias);
+        return;
+    }
+
+    convolveParallel(rInputDecoder, rOutputEncoder, rFilterDecoder, pBiasDecoder);
+}
+
+} // anonymous namespace
+
+void Convolve(RefThreadPool& threadPool,
+              const TensorShape& rInputShape,
+              Decoder<float>& rInputDecoder,
+              const TensorShape& rOutputShape,
+              Encoder<float>& rOutputEncoder,
+              const TensorShape& rFilterShape,
+              Decoder<float>& rFilterDecoder,
+              bool biasEnabled,
+              Decoder<float>* pBiasDecoder,
+              DataLayout dataLayout,
+              unsigned int paddingTop,
+              unsigned int paddingLeft,
+              unsigned int xStride,
+              unsigned int yStride,
+              unsigned int xDilation,
+              unsigned int yDilation,
+              bool depthwise,
+              ConvolutionMethod method)
+{
+    if (biasEnabled && !pBiasDecoder)
+    {
+        throw InvalidArgumentException("Bias is enabled but the bias data is invalid");
     }
+
+    if (method == ConvolutionMethod::Auto)
+    {
+        // Only the GEMM implementation has an integer path for QAsymm8, which is faster whatever the shapes.
+        const unsigned int numProducts = depthwise ? rFilterShape[2] * rFilterShape[3]
+                                                   : rFilterShape.GetNumElements() / rFilterShape[0];
+        const bool isIntegerConvolution =
+            GetQuantizedProductParams(rInputDecoder, rFilterDecoder, biasEnabled ? pBiasDecoder : nullptr,
+                                      rOutputEncoder, numProducts).has_value();
+        method = isIntegerConvolution || IsGemmConvolutionPreferred(rOutputShape, dataLayout) ?
+                 ConvolutionMethod::Gemm : ConvolutionMethod::Direct;
+    }
+
+    auto convolve = method == ConvolutionMethod::Gemm ? ConvolveGemm : ConvolveDirect;
+    convolve(threadPool, rInputShape, rInputDecoder, rOutputShape, rOutputEncoder, rFilterShape, rFilterDecoder,
+             biasEnabled, pBiasDecoder, dataLayout, paddingTop, paddingLeft, xStride, yStride,
+             xDilation, yDilation, depthwise);
 }
 
 } // namespace armnn
@@ -10,6 +10,7 @@
 #include "BaseIterator.hpp"
 #include "Decoders.hpp"
 #include "Encoders.hpp"
+#include "RefThreadPool.hpp"
 
 #include <armnn/Tensor.hpp>
 
@@ -50,7 +51,21 @@ private:
     int32_t m_RightShift;
 };
 
-void Convolve(const TensorShape& rInputShape,
+/// The algorithms Convolve() can use. They give the same results, except that Gemm computes QAsymm8 convolutions
+/// with integer arithmetic where possible, whose requantized outputs may differ from the float ones by one.
+enum class ConvolutionMethod
+{
+    /// Picks one of the others from the shapes and data types of the tensors.
+    Auto,
+    /// Accumulates each output element in turn straight from the input and filter iterators.
+    Direct,
+    /// Packs the filter once and multiplies it with tiles of the input lowered to patch matrices (im2col).
+    Gemm
+};
+
+/// Splits the convolution across the threads of threadPool.
+void Convolve(RefThreadPool& threadPool,
+              const TensorShape& rInputShape,
               Decoder<float>& rInputDecoder,
               const TensorShape& rOutputShape,
               Encoder<float>& rOutputEncoder,
@@ -65,5 +80,6 @@ void Convolve(const TensorShape& rInputShape,
               unsigned int yStride,
               unsigned int xDilation,
               unsigned int yDilation,
-              bool depthwise = false);
+              bool depthwise = false,
+              ConvolutionMethod method = ConvolutionMethod::Auto);
 } //namespace armnn
@@ -5,14 +5,165 @@
 
 #include "ElementwiseFunction.hpp"
 #include "Broadcast.hpp"
+#include "IteratorDispatch.hpp"
+#include "QuantizedArithmetic.hpp"
 #include <functional>
 #include "Minimum.hpp"
 
 #include "Maximum.hpp"
 
+#include <algorithm>
+
 namespace armnn
 {
 
+namespace
+{
+
+template <typename Functor, typename DecoderType, typename EncoderType>
+void ElementwiseImpl(const TensorShape& inShape0,
+                     const TensorShape& inShape1,
+                     const TensorShape& outShape,
+                     Functor func,
+                     DecoderType& inData0,
+                     DecoderType& inData1,
+                     EncoderType& outData)
+{
+    BroadcastLoop(inShape0, inShape1, outShape).Unroll(func, 0, inData0, inData1, outData);
+}
+
+template <typename Functor, typename EncoderType>
+void ElementwiseImpl(const TensorShape& inShape0,
+                     const TensorShape& inShape1,
+                     const TensorShape& outShape,
+                     Functor func,
+                     Float32Decoder& inData0,
+                     Float32Decoder& inData1,
+                     EncoderType& outData)
+{
+    if (inShape0 == outShape && inShape1 == outShape)
+    {
+        // Without broadcasting the tensors are walked in step, which can be vectorized.
+        const float* in0 = inData0.GetPointer();
+        const float* in1 = inData1.GetPointer();
+        auto out = outData.GetPointer();
+        const unsigned int numElements = outShape.GetNumElements();
+        for (unsigned int i = 0; i < numElements; ++i)
+        {
+            out[i] = func(in0[i], in1[i]);
+        }
+        return;
+    }
+
+    BroadcastLoop(inShape0, inShape1, outShape).Unroll(func, 0, inData0, inData1, outData);
+}
+
+/// Reads or writes the quantized values of a tensor in place, so that BroadcastLoop can walk them.
+template <typename T>
+class QuantizedValueIterator
+{
+public:
+    QuantizedValueIterator(T* data) : m_Iterator(data) {}
+
+    int32_t Get() const
+    {
+        return static_cast<int32_t>(*m_Iterator);
+    }
+
+    void Set(uint8_t value)
+    {
+        *m_Iterator = value;
+    }
+
+    QuantizedValueIterator& operator+=(const unsigned int increment)
+    {
+        m_Iterator += increment;
+        return *this;
+    }
+
+    QuantizedValueIterator& operator-=(const unsigned int increment)
+    {
+        m_Iterator -= increment;
+        return *this;
+    }
+
+private:
+    T* m_Iterator;
+};
+
+/// Adds two QAsymm8 values with integer arithmetic, the same way as TensorFlow Lite's quantized kernels: both
+/// inputs are shifted left to keep precision, brought to a common scale of twice the larger input scale with
+/// multipliers of at most one half, added, and requantized to the output scale.
+class QuantizedAddition
+{
+public:
+    QuantizedAddition(const QASymm8Decoder& in0, const QASymm8Decoder& in1, const QASymm8Encoder& out)
+        : m_InputOffset0(in0.GetOffset())
+        , m_InputOffset1(in1.GetOffset())
+        , m_OutputOffset(out.GetOffset())
+        , m_InputMultiplier0(in0.GetScale() / GetCommonScale(in0, in1))
+        , m_InputMultiplier1(in1.GetScale() / GetCommonScale(in0, in1))
+        , m_OutputMultiplier(GetOutputMultiplier(in0, in1, out))
+    {}
+
+    /// Returns whether the output scale is large enough for the output multiplier to be smaller than one.
+    static bool IsSupported(const QASymm8Decoder& in0, const QASymm8Decoder& in1, const QASymm8Encoder& out)
+    {
+        return IsMultiplierSmallerThanOne(GetOutputMultiplier(in0, in1, out));
+    }
+
+    uint8_t operator()(int32_t value0, int32_t value1) const
+    {
+        const int32_t shifted0 = (value0 - m_InputOffset0) * (1 << g_LeftShift);
+        const int32_t shifted1 = (value1 - m_InputOffset1) * (1 << g_LeftShift);
+        return Requantize((m_InputMultiplier0 * shifted0) + (m_InputMultiplier1 * shifted1),
+                          m_OutputMultiplier, m_OutputOffset);
+    }
+
+private:
+    static constexpr int g_LeftShift = 20;
+
+    static float GetCommonScale(const QASymm8Decoder& in0, const QASymm8Decoder& in1)
+    {
+        return 2.0f * std::max(in0.GetScale(), in1.GetScale());
+    }
+
+    static float GetOutputMultiplier(const QASymm8Decoder& in0, const QASymm8Decoder& in1, const QASymm8Encoder& out)
+    {
+        return GetCommonScale(in0, in1) / (static_cast<float>(1 << g_LeftShift) * out.GetScale());
+    }
+
+    int32_t m_InputOffset0;
+    int32_t m_InputOffset1;
+    int32_t m_OutputOffset;
+    QuantizedMultiplierSmallerThanOne m_InputMultiplier0;
+    QuantizedMultiplierSmallerThanOne m_InputMultiplier1;
+    QuantizedMultiplierSmallerThanOne m_OutputMultiplier;
+};
+
+void ElementwiseImpl(const TensorShape& inShape0,
+                     const TensorShape& inShape1,
+                     const TensorShape& outShape,
+                     std::plus<float> func,
+                     QASymm8Decoder& inData0,
+                     QASymm8Decoder& inData1,
+                     QASymm8Encoder& outData)
+{
+    if (!QuantizedAddition::IsSupported(inData0, inData1, outData))
+    {
+        BroadcastLoop(inShape0, inShape1, outShape).Unroll(func, 0, inData0, inData1, outData);
+        return;
+    }
+
+    const QuantizedAddition add(inData0, inData1, outData);
+    QuantizedValueIterator<const uint8_t> in0(inData0.GetPointer());
+    QuantizedValueIterator<const uint8_t> in1(inData1.GetPointer());
+    QuantizedValueIterator<uint8_t> out(outData.GetPointer());
+    BroadcastLoop(inShape0, inShape1, outShape).Unroll(add, 0, in0, in1, out);
+}
+
+} // anonymous namespace
+
 template <typename Functor>
 ElementwiseFunction<Functor>::ElementwiseFunction(const TensorShape& inShape0,
                                                    const TensorShape& inShape1,
@@ -21,7 +172,10 @@ ElementwiseFunction<Functor>::ElementwiseFunction(const TensorShape& inShape0,
                                                    armnn::Decoder<InType>& inData1,
                                                    armnn::Encoder<OutType>& outData)
 {
-    BroadcastLoop(inShape0, inShape1, outShape).Unroll(Functor(), 0, inData0, inData1, outData);
+    DispatchTypedIterators(inData0, inData1, outData, [&](auto& typedInData0, auto& typedInData1, auto& typedOutData)
+    {
+        ElementwiseImpl(inShape0, inShape1, outShape, Functor(), typedInData0, typedInData1, typedOutData);
+    });
 }
 
 } //namespace armnn
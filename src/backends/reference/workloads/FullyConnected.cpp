@@ -5,14 +5,19 @@
 
 #include "FullyConnected.hpp"
 
+#include "QuantizedArithmetic.hpp"
 #include "RefWorkloadUtils.hpp"
 
 #include <boost/assert.hpp>
 
+#include <algorithm>
+#include <vector>
+
 namespace armnn
 {
 
-void FullyConnected(const TensorShape& rInputShape,
+void FullyConnected(RefThreadPool& threadPool,
+                    const TensorShape& rInputShape,
                     Decoder<float>& rInputDecoder,
                     const TensorShape& rOutputShape,
                     Encoder<float>& rOutputEncoder,
@@ -25,10 +30,19 @@ void FullyConnected(const TensorShape& rInputShape,
     // Perform FullyConnected implementation
     unsigned int outputSize = rOutputShape[1];
 
-    for (unsigned int n = 0; n < rInputShape[0]; n++)
+    // Computes the outputs [begin, end), numbered across the batch and output channel dimensions.
+    auto computeOutputs = [&](Decoder<float>& rInputDecoder,
+                              Encoder<float>& rOutputEncoder,
+                              Decoder<float>& rWeightDecoder,
+                              Decoder<float>* pBiasDecoder,
+                              unsigned int begin,
+                              unsigned int end)
     {
-        for (unsigned int channelOutput = 0; channelOutput < outputSize; channelOutput++)
+        for (unsigned int outputIdx = begin; outputIdx < end; outputIdx++)
         {
+            const unsigned int n             = outputIdx / outputSize;
+            const unsigned int channelOutput = outputIdx % outputSize;
+
             float outval = 0.f;
 
             for (unsigned int channelInput = 0; channelInput < K; channelInput++)
@@ -51,14 +65,85 @@ void FullyConnected(const TensorShape& rInputShape,
 
             if (biasEnabled)
             {
-                rBiasDecoder[channelOutput];
-                outval += rBiasDecoder.Get();
+                (*pBiasDecoder)[channelOutput];
+                outval += pBiasDecoder->Get();
             }
 
             rOutputEncoder[n * outputSize + channelOutput];
             rOutputEncoder.Set(outval);
         }
+    };
+
+    // Each output is computed by a single thread in the same order as before, so the results don't depend on the
+    // thread count.
+    const unsigned int numOutputs = rInputShape[0] * outputSize;
+    const unsigned int outputsPerRange = std::max(1u, g_MinMacsPerParallelRange / std::max(1u, K));
+
+    // QAsymm8 layers whose output can be requantized with an integer multiplier accumulate the products of the
+    // offset-corrected inputs and weights in int32 instead of decoding them to float.
+    const Optional<QuantizedProductParams> quantizedParams =
+        GetQuantizedProductParams(rInputDecoder, rWeightDecoder, biasEnabled ? &rBiasDecoder : nullptr,
+                                  rOutputEncoder, K);
+    if (quantizedParams.has_value())
+    {
+        const QuantizedProductParams& params = quantizedParams.value();
+
+        const uint8_t* input   = static_cast<QASymm8Decoder&>(rInputDecoder.SetIndex(0)).GetPointer();
+        const uint8_t* weights = static_cast<QASymm8Decoder&>(rWeightDecoder.SetIndex(0)).GetPointer();
+        const int32_t* biases  = biasEnabled ?
+                                 static_cast<ScaledInt32Decoder&>(rBiasDecoder.SetIndex(0)).GetPointer() : nullptr;
+        uint8_t* output = static_cast<QASymm8Encoder&>(rOutputEncoder.SetIndex(0)).GetPointer();
+
+        const unsigned int weightStride = transposeWeights ? 1 : outputSize;
+        threadPool.ParallelFor(numOutputs, outputsPerRange, [&](unsigned int begin, unsigned int end)
+        {
+            for (unsigned int outputIdx = begin; outputIdx < end; outputIdx++)
+            {
+                const unsigned int n             = outputIdx / outputSize;
+                const unsigned int channelOutput = outputIdx % outputSize;
+
+                const uint8_t* inputRow = &input[n * K];
+                const uint8_t* weight   = &weights[transposeWeights ? channelOutput * K : channelOutput];
+
+                int32_t outval = biases ? biases[channelOutput] : 0;
+                for (unsigned int channelInput = 0; channelInput < K; channelInput++, weight += weightStride)
+                {
+                    outval += (static_cast<int32_t>(inputRow[channelInput]) - params.m_InputOffset) *
+                              (static_cast<int32_t>(*weight) - params.m_WeightOffset);
+                }
+
+                output[outputIdx] = Requantize(outval, params.m_OutputMultiplier, params.m_OutputOffset);
+            }
+        });
+        return;
+    }
+
+    const unsigned int numRanges = threadPool.GetNumRanges(numOutputs, outputsPerRange);
+    if (numRanges == 1)
+    {
+        computeOutputs(rInputDecoder, rOutputEncoder, rWeightDecoder, &rBiasDecoder, 0, numOutputs);
+        return;
     }
+
+    // The decoders and encoder keep their position, so each range works on its own copies. They are all made before
+    // the ranges start, while nothing moves the originals.
+    std::vector<std::unique_ptr<Decoder<float>>> inputDecoders;
+    std::vector<std::unique_ptr<Encoder<float>>> outputEncoders;
+    std::vector<std::unique_ptr<Decoder<float>>> weightDecoders;
+    std::vector<std::unique_ptr<Decoder<float>>> biasDecoders;
+    for (unsigned int range = 0; range < numRanges; ++range)
+    {
+        inputDecoders.push_back(rInputDecoder.Clone());
+        outputEncoders.push_back(rOutputEncoder.Clone());
+        weightDecoders.push_back(rWeightDecoder.Clone());
+        biasDecoders.push_back(biasEnabled ? rBiasDecoder.Clone() : nullptr);
+    }
+
+    threadPool.ParallelForEachRange(numOutputs, numRanges, [&](unsigned int range, unsigned int begin, unsigned int end)
+    {
+        computeOutputs(*inputDecoders[range], *outputEncoders[range], *weightDecoders[range],
+                       biasDecoders[range].get(), begin, end);
+    });
 }
 
 } //namespace armnn
@@ -8,14 +8,16 @@
 #include "BaseIterator.hpp"
 #include "Decoders.hpp"
 #include "Encoders.hpp"
+#include "RefThreadPool.hpp"
 #include <armnn/Tensor.hpp>
 #include <backendsCommon/WorkloadData.hpp>
 
 namespace armnn
 {
 
-/// Performs a matrix multiplication and optionally adds a bias.
-void FullyConnected(const TensorShape& rInputShape,
+/// Performs a matrix multiplication and optionally adds a bias, split across the threads of threadPool.
+void FullyConnected(RefThreadPool& threadPool,
+                    const TensorShape& rInputShape,
                     Decoder<float>& rInputDecoder,
                     const TensorShape& rOutputShape,
                     Encoder<float>& rOutputEncoder,
@@ -0,0 +1,110 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "BaseIterator.hpp"
+
+#include <memory>
+#include <utility>
+
+namespace armnn
+{
+
+// Reading and writing tensors through Decoder<float> and Encoder<float> costs a virtual call per element.
+// Kernels written as templates over their iterator types can instead be instantiated for the final
+// Float32 and QAsymm8 iterator classes, for which the compiler resolves and inlines those calls.
+// The functions below call such a kernel with the most specific iterator types they find, and with
+// the generic interfaces otherwise.
+
+/// Calls func(in, out), with in and out downcast to their concrete types if both are Float32
+/// or both are QAsymm8.
+template<typename Func>
+void DispatchTypedIterators(Decoder<float>& in, Encoder<float>& out, Func&& func)
+{
+    if (auto float32In = dynamic_cast<Float32Decoder*>(&in))
+    {
+        if (auto float32Out = dynamic_cast<Float32Encoder*>(&out))
+        {
+            func(*float32In, *float32Out);
+            return;
+        }
+    }
+    else if (auto qAsymm8In = dynamic_cast<QASymm8Decoder*>(&in))
+    {
+        if (auto qAsymm8Out = dynamic_cast<QASymm8Encoder*>(&out))
+        {
+            func(*qAsymm8In, *qAsymm8Out);
+            return;
+        }
+    }
+
+    func(in, out);
+}
+
+/// Calls func(in0, in1, out), with the iterators downcast to their concrete types if they are all Float32
+/// or all QAsymm8.
+template<typename Func>
+void DispatchTypedIterators(Decoder<float>& in0, Decoder<float>& in1, Encoder<float>& out, Func&& func)
+{
+    if (auto float32In0 = dynamic_cast<Float32Decoder*>(&in0))
+    {
+        auto float32In1 = dynamic_cast<Float32Decoder*>(&in1);
+        auto float32Out = dynamic_cast<Float32Encoder*>(&out);
+        if (float32In1 && float32Out)
+        {
+            func(*float32In0, *float32In1, *float32Out);
+            return;
+        }
+    }
+    else if (auto qAsymm8In0 = dynamic_cast<QASymm8Decoder*>(&in0))
+    {
+        auto qAsymm8In1 = dynamic_cast<QASymm8Decoder*>(&in1);
+        auto qAsymm8Out = dynamic_cast<QASymm8Encoder*>(&out);
+        if (qAsymm8In1 && qAsymm8Out)
+        {
+            func(*qAsymm8In0, *qAsymm8In1, *qAsymm8Out);
+            return;
+        }
+    }
+
+    func(in0, in1, out);
+}
+
+/// Calls func(in0, in1, out), with the inputs downcast to Float32Decoder and the output to BooleanEncoder
+/// if the inputs are both Float32.
+template<typename Func>
+void DispatchTypedIterators(Decoder<float>& in0, Decoder<float>& in1, Encoder<bool>& out, Func&& func)
+{
+    auto float32In0 = dynamic_cast<Float32Decoder*>(&in0);
+    auto float32In1 = dynamic_cast<Float32Decoder*>(&in1);
+    auto booleanOut = dynamic_cast<BooleanEncoder*>(&out);
+    if (float32In0 && float32In1 && booleanOut)
+    {
+        func(*float32In0, *float32In1, *booleanOut);
+        return;
+    }
+
+    func(in0, in1, out);
+}
+
+/// Returns an independent copy of an iterator, keeping its concrete type if it is known.
+template<typename Iterator>
+std::unique_ptr<Iterator> CopyIterator(const Iterator& iterator)
+{
+    return std::make_unique<Iterator>(iterator);
+}
+
+inline std::unique_ptr<Decoder<float>> CopyIterator(const Decoder<float>& decoder)
+{
+    return decoder.Clone();
+}
+
+inline std::unique_ptr<Encoder<float>> CopyIterator(const Encoder<float>& encoder)
+{
+    return encoder.Clone();
+}
+
+} // namespace armnn
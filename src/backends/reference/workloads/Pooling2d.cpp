@@ -5,6 +5,8 @@
 
 #include "Pooling2d.hpp"
 #include "DataLayoutIndexed.hpp"
+#include "IteratorDispatch.hpp"
+#include "QuantizedArithmetic.hpp"
 
 #include <armnn/Exceptions.hpp>
 #include <armnn/Types.hpp>
@@ -14,6 +16,7 @@
 #include <limits>
 #include <algorithm>
 #include <functional>
+#include <vector>
 
 namespace
 {
@@ -133,6 +136,102 @@ namespace
             return false;
         }
     }
+
+    /// The input region covered by the pooling window of one output element, clamped to the input.
+    struct PoolingWindow
+    {
+        int m_Batch;
+        int m_Channel;
+        unsigned int m_OutputIndex;
+        /// Whether the window only covers padding, in which case the result is zero by convention.
+        bool m_PaddingOnly;
+        int m_HStart;
+        int m_HEnd;
+        int m_WStart;
+        int m_WEnd;
+        /// The number of elements an average is divided by.
+        int m_PoolAreaSize;
+    };
+
+    /// Computes max and average poolings of QAsymm8 tensors with integer arithmetic. Max pooling picks the largest
+    /// quantized value, average pooling sums the offset-corrected values, and both rescale the result to the output
+    /// quantization with a QuantizedMultiplierSmallerThanOne, folding the division by the pool area into it so that
+    /// the result is rounded once. Returns false without computing anything if the tensors aren't QAsymm8, for L2
+    /// pooling, and if the input scale is larger than the output one.
+    template<typename ForEachPoolingWindow, typename GetInputIndex>
+    bool QuantizedPooling2d(armnn::Decoder<float>& rInputDecoder,
+                            armnn::Encoder<float>& rOutputEncoder,
+                            PoolingAlgorithm algorithm,
+                            int maxPoolAreaSize,
+                            ForEachPoolingWindow&& forEachPoolingWindow,
+                            GetInputIndex&& getInputIndex)
+    {
+        using namespace armnn;
+
+        auto quantizedInput  = dynamic_cast<QASymm8Decoder*>(&rInputDecoder);
+        auto quantizedOutput = dynamic_cast<QASymm8Encoder*>(&rOutputEncoder);
+        if (!quantizedInput || !quantizedOutput || algorithm == PoolingAlgorithm::L2)
+        {
+            return false;
+        }
+
+        const float scaleRatio = quantizedInput->GetScale() / quantizedOutput->GetScale();
+        if (scaleRatio > 1.0f)
+        {
+            return false;
+        }
+
+        // The multiplier applied to results over poolAreaSize values is scaleRatio / poolAreaSize for averages and
+        // scaleRatio for maxima. It is smaller than one, except when the scales are equal and the result is either
+        // a maximum or the sum of a single value, which is then copied. Windows that only cover padding have a
+        // result of zero whatever their size.
+        std::vector<Optional<QuantizedMultiplierSmallerThanOne>> multipliers;
+        multipliers.reserve(boost::numeric_cast<size_t>(maxPoolAreaSize) + 1);
+        multipliers.emplace_back(EmptyOptional());
+        for (int poolAreaSize = 1; poolAreaSize <= maxPoolAreaSize; ++poolAreaSize)
+        {
+            const float multiplier = algorithm == PoolingAlgorithm::Max ?
+                                     scaleRatio : scaleRatio / static_cast<float>(poolAreaSize);
+            if (IsMultiplierSmallerThanOne(multiplier))
+            {
+                multipliers.emplace_back(QuantizedMultiplierSmallerThanOne(multiplier));
+            }
+            else
+            {
+                multipliers.emplace_back(EmptyOptional());
+            }
+        }
+
+        const int32_t inputOffset  = quantizedInput->GetOffset();
+        const int32_t outputOffset = quantizedOutput->GetOffset();
+        const uint8_t* input = quantizedInput->SetIndex(0).GetPointer();
+        uint8_t* output      = quantizedOutput->SetIndex(0).GetPointer();
+
+        forEachPoolingWindow([&](const PoolingWindow& window)
+        {
+            int32_t result = 0;
+            if (!window.m_PaddingOnly)
+            {
+                result = algorithm == PoolingAlgorithm::Max ? std::numeric_limits<int32_t>::lowest() : 0;
+                for (auto yInput = window.m_HStart; yInput < window.m_HEnd; yInput++)
+                {
+                    for (auto xInput = window.m_WStart; xInput < window.m_WEnd; xInput++)
+                    {
+                        const int32_t value = static_cast<int32_t>(input[getInputIndex(window, yInput, xInput)]) -
+                                              inputOffset;
+                        result = algorithm == PoolingAlgorithm::Max ? std::max(result, value) : result + value;
+                    }
+                }
+            }
+
+            const Optional<QuantizedMultiplierSmallerThanOne>& multiplier = multipliers[window.m_PoolAreaSize];
+            output[window.m_OutputIndex] = multiplier.has_value() ?
+                                           Requantize(result, multiplier.value(), outputOffset) :
+                                           SaturateToQAsymm8(result + outputOffset);
+        });
+
+        return true;
+    }
 }
 
 using namespace armnnUtils;
@@ -181,94 +280,112 @@ void Pooling2d(Decoder<float>& rInputDecoder,
         throw armnn::InvalidArgumentException("Unsupported padding type");
     }
 
-    for (int n = 0; n < batchSize; n++)
+    // Calls pool(window) with the pooling window of each output element.
+    auto forEachPoolingWindow = [&](auto&& pool)
     {
-        for (int c = 0; c < channels; c++)
+        for (int n = 0; n < batchSize; n++)
         {
-            for (int yOutput = 0; yOutput < heightOutput; yOutput++)
+            for (int c = 0; c < channels; c++)
             {
-                //  Calculate values independent of the x axis
-                int hstart = (yOutput * strideY) - padTop;
-                int hend = hstart + poolHeight;
-                // Clamp the pooling region inside the valid input area (which includes the padding).
-                // This is necessary because the final pooling in a row may overlap beyond the padding.
-                hend = std::min(hend, heightInput + padBottom);
-
-                int height = hend - hstart;
-                bool hclamped = ClampRange(hstart, hend, heightInput);
-
-                for (int xOutput = 0; xOutput < widthOutput; xOutput++)
+                for (int yOutput = 0; yOutput < heightOutput; yOutput++)
                 {
-                    int wstart = (xOutput * strideX) - padLeft;
-                    int wend = wstart + poolWidth;
-
+                    //  Calculate values independent of the x axis
+                    int hstart = (yOutput * strideY) - padTop;
+                    int hend = hstart + poolHeight;
                     // Clamp the pooling region inside the valid input area (which includes the padding).
                     // This is necessary because the final pooling in a row may overlap beyond the padding.
-                    wend = std::min(wend, widthInput + padRight);
-
-                    float result = defaultInitializer;
-                    float poolAreaSize = boost::numeric_cast<float>(height * (wend - wstart));
-
-                    // Special case: when the pooling kernel is over a padding region and the padding
-                    //               size is larger or equal to the kernel and the kernel only covers
-                    //               padding and no real values, then we initialize the result as zero
-                    //               by convention. This is because we need to choose a value here and
-                    //               all values we have are padding, which we ignore.
-                    if (OnPaddingOnly(hstart, hend, heightInput) ||
-                        OnPaddingOnly(wstart, wend, widthInput))
+                    hend = std::min(hend, heightInput + padBottom);
+
+                    int height = hend - hstart;
+                    bool hclamped = ClampRange(hstart, hend, heightInput);
+
+                    for (int xOutput = 0; xOutput < widthOutput; xOutput++)
                     {
-                        result = 0.0f;
+                        int wstart = (xOutput * strideX) - padLeft;
+                        int wend = wstart + poolWidth;
+
+                        // Clamp the pooling region inside the valid input area (which includes the padding).
+                        // This is necessary because the final pooling in a row may overlap beyond the padding.
+                        wend = std::min(wend, widthInput + padRight);
+
+                        int poolAreaSize = height * (wend - wstart);
 
                         unsigned int outputIndex = dataLayout.GetIndex(outputShape,
                                                                        boost::numeric_cast<unsigned int>(n),
                                                                        boost::numeric_cast<unsigned int>(c),
                                                                        boost::numeric_cast<unsigned int>(yOutput),
                                                                        boost::numeric_cast<unsigned int>(xOutput));
-                        rOutputEncoder[outputIndex];
-                        rOutputEncoder.Set(result);
-                        continue;
-                    }
-
-                    bool clamped = hclamped |= ClampRange(wstart, wend, widthInput);
 
-                    if (clamped && params.m_PaddingMethod == PaddingMethod::Exclude)
-                    {
-                        // When we exclude the padding, it means we calculate with a smaller
-                        // kernel size, so I changed the divisor here.
-                        poolAreaSize = boost::numeric_cast<float>((hend - hstart) * (wend - wstart));
-                    }
-
-                    for (auto yInput = hstart; yInput < hend; yInput++)
-                    {
-                        for (auto xInput = wstart; xInput < wend; xInput++)
+                        // Special case: when the pooling kernel is over a padding region and the padding
+                        //               size is larger or equal to the kernel and the kernel only covers
+                        //               padding and no real values, then we initialize the result as zero
+                        //               by convention. This is because we need to choose a value here and
+                        //               all values we have are padding, which we ignore.
+                        if (OnPaddingOnly(hstart, hend, heightInput) ||
+                            OnPaddingOnly(wstart, wend, widthInput))
                         {
-                            unsigned int inputIndex = dataLayout.GetIndex(inputShape,
-                                                                          boost::numeric_cast<unsigned int>(n),
-                                                                          boost::numeric_cast<unsigned int>(c),
-                                                                          boost::numeric_cast<unsigned int>(yInput),
-                                                                          boost::numeric_cast<unsigned int>(xInput));
+                            pool(PoolingWindow{ n, c, outputIndex, true, hstart, hstart, wstart, wstart,
+                                                poolAreaSize });
+                            continue;
+                        }
 
-                            rInputDecoder[inputIndex];
-                            float inval = rInputDecoder.Get();
+                        bool clamped = hclamped |= ClampRange(wstart, wend, widthInput);
 
-                            accumulate(result, inval);
+                        if (clamped && params.m_PaddingMethod == PaddingMethod::Exclude)
+                        {
+                            // When we exclude the padding, it means we calculate with a smaller
+                            // kernel size, so I changed the divisor here.
+                            poolAreaSize = (hend - hstart) * (wend - wstart);
                         }
+
+                        pool(PoolingWindow{ n, c, outputIndex, false, hstart, hend, wstart, wend, poolAreaSize });
                     }
+                }
+            }
+        }
+    };
 
-                    execute(result, poolAreaSize);
+    auto getInputIndex = [&](const PoolingWindow& window, int yInput, int xInput)
+    {
+        return dataLayout.GetIndex(inputShape,
+                                   boost::numeric_cast<unsigned int>(window.m_Batch),
+                                   boost::numeric_cast<unsigned int>(window.m_Channel),
+                                   boost::numeric_cast<unsigned int>(yInput),
+                                   boost::numeric_cast<unsigned int>(xInput));
+    };
+
+    if (QuantizedPooling2d(rInputDecoder, rOutputEncoder, params.m_PoolType, poolHeight * poolWidth,
+                           forEachPoolingWindow, getInputIndex))
+    {
+        return;
+    }
 
-                    unsigned int outputIndex = dataLayout.GetIndex(outputShape,
-                                                                   boost::numeric_cast<unsigned int>(n),
-                                                                   boost::numeric_cast<unsigned int>(c),
-                                                                   boost::numeric_cast<unsigned int>(yOutput),
-                                                                   boost::numeric_cast<unsigned int>(xOutput));
+    // Instantiated for the concrete iterator types when possible, so that their element accesses are inlined.
+    DispatchTypedIterators(rInputDecoder, rOutputEncoder, [&](auto& inputDecoder, auto& outputEncoder)
+    {
+        forEachPoolingWindow([&](const PoolingWindow& window)
+        {
+            float result = window.m_PaddingOnly ? 0.0f : defaultInitializer;
+            if (!window.m_PaddingOnly)
+            {
+                for (auto yInput = window.m_HStart; yInput < window.m_HEnd; yInput++)
+                {
+                    for (auto xInput = window.m_WStart; xInput < window.m_WEnd; xInput++)
+                    {
+                        inputDecoder[getInputIndex(window, yInput, xInput)];
+                        float inval = inputDecoder.Get();
 
-                    rOutputEncoder[outputIndex];
-                    rOutputEncoder.Set(result);
+                        accumulate(result, inval);
+                    }
                 }
+
+                execute(result, boost::numeric_cast<float>(window.m_PoolAreaSize));
             }
-        }
-    }
+
+            outputEncoder[window.m_OutputIndex];
+            outputEncoder.Set(result);
+        });
+    });
 }
 
 } //namespace armnn
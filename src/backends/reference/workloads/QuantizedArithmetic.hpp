@@ -0,0 +1,104 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "BaseIterator.hpp"
+#include "ConvImpl.hpp"
+
+#include <armnn/Optional.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace armnn
+{
+
+/// Returns whether a real multiplier can be applied with QuantizedMultiplierSmallerThanOne.
+inline bool IsMultiplierSmallerThanOne(float multiplier)
+{
+    return multiplier >= 0.0f && multiplier < 1.0f;
+}
+
+/// Saturates an integer to the range of QAsymm8 values.
+inline uint8_t SaturateToQAsymm8(int32_t value)
+{
+    return static_cast<uint8_t>(std::min<int32_t>(std::max<int32_t>(value, std::numeric_limits<uint8_t>::min()),
+                                                  std::numeric_limits<uint8_t>::max()));
+}
+
+/// Scales an integer by a multiplier smaller than one, adds the output offset and saturates to uint8.
+inline uint8_t Requantize(int32_t value, const QuantizedMultiplierSmallerThanOne& multiplier, int32_t offset)
+{
+    return SaturateToQAsymm8((multiplier * value) + offset);
+}
+
+/// The integer quantities needed to compute sums of products of QAsymm8 inputs and QAsymm8 weights, plus an
+/// optional Signed32 bias, into a QAsymm8 output entirely with integer arithmetic:
+///     output = Requantize(bias + sum((input - m_InputOffset) * (weight - m_WeightOffset)))
+struct QuantizedProductParams
+{
+    QuantizedProductParams(int32_t inputOffset,
+                           int32_t weightOffset,
+                           int32_t outputOffset,
+                           float outputMultiplier)
+        : m_InputOffset(inputOffset)
+        , m_WeightOffset(weightOffset)
+        , m_OutputOffset(outputOffset)
+        , m_OutputMultiplier(outputMultiplier)
+    {}
+
+    int32_t m_InputOffset;
+    int32_t m_WeightOffset;
+    int32_t m_OutputOffset;
+    QuantizedMultiplierSmallerThanOne m_OutputMultiplier;
+};
+
+/// Returns the parameters of the integer computation if the input, weights and output are all QAsymm8, the bias
+/// (if any) is Signed32 with a scale of inputScale * weightScale, inputScale * weightScale / outputScale is smaller
+/// than one, and numProducts products can be summed without overflowing an int32. Returns an empty Optional
+/// otherwise, in which case the float implementation has to be used.
+inline Optional<QuantizedProductParams> GetQuantizedProductParams(const Decoder<float>& input,
+                                                                  const Decoder<float>& weights,
+                                                                  const Decoder<float>* bias,
+                                                                  const Encoder<float>& output,
+                                                                  unsigned int numProducts)
+{
+    auto qAsymm8Input   = dynamic_cast<const QASymm8Decoder*>(&input);
+    auto qAsymm8Weights = dynamic_cast<const QASymm8Decoder*>(&weights);
+    auto qAsymm8Output  = dynamic_cast<const QASymm8Encoder*>(&output);
+    auto int32Bias      = dynamic_cast<const ScaledInt32Decoder*>(bias);
+    if (!qAsymm8Input || !qAsymm8Weights || !qAsymm8Output || (bias && !int32Bias))
+    {
+        return EmptyOptional();
+    }
+
+    // Each product of two offset-corrected uint8 values is below 2^16.
+    constexpr unsigned int maxNumProducts = std::numeric_limits<int32_t>::max() / (1 << 16);
+    if (numProducts > maxNumProducts)
+    {
+        return EmptyOptional();
+    }
+
+    const float productScale = qAsymm8Input->GetScale() * qAsymm8Weights->GetScale();
+    if (int32Bias && std::abs(int32Bias->GetScale() - productScale) > productScale * 1e-5f)
+    {
+        return EmptyOptional();
+    }
+
+    const float outputMultiplier = productScale / qAsymm8Output->GetScale();
+    if (!IsMultiplierSmallerThanOne(outputMultiplier))
+    {
+        return EmptyOptional();
+    }
+
+    return QuantizedProductParams(qAsymm8Input->GetOffset(),
+                                  qAsymm8Weights->GetOffset(),
+                                  qAsymm8Output->GetOffset(),
+                                  outputMultiplier);
+}
+
+} // namespace armnn
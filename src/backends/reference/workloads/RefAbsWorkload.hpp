@@ -15,7 +15,11 @@ class RefAbsWorkload : public BaseWorkload<AbsQueueDescriptor>
 {
 public:
     using BaseWorkload<AbsQueueDescriptor>::BaseWorkload;
-    virtual void Execute() const override;
+    void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const std::vector<ITensorHandle*>& inputs, const std::vector<ITensorHandle*>& outputs) const;
 };
 
 } //namespace armnn
@@ -16,7 +16,11 @@ class RefBatchToSpaceNdWorkload : public BaseWorkload<BatchToSpaceNdQueueDescrip
 public:
     using BaseWorkload<BatchToSpaceNdQueueDescriptor>::BaseWorkload;
 
-    virtual void Execute() const override;
+    void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const std::vector<ITensorHandle*>& inputs, const std::vector<ITensorHandle*>& outputs) const;
 };
 
 } // namespace armnn
\ No newline at end of file
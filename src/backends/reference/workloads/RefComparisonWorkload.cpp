@@ -37,21 +37,42 @@ void RefComparisonWorkload::PostAllocationConfigure()
 }
 
 void RefComparisonWorkload::Execute() const
+{
+    m_Input0->Reset(m_Data.m_Inputs[0]->Map());
+    m_Input1->Reset(m_Data.m_Inputs[1]->Map());
+    m_Output->Reset(m_Data.m_Outputs[0]->Map());
+
+    Execute(m_Data.m_Inputs, m_Data.m_Outputs, *m_Input0, *m_Input1, *m_Output);
+}
+
+void RefComparisonWorkload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    const std::vector<ITensorHandle*>& inputs  = workingMemDescriptor.m_Inputs;
+    const std::vector<ITensorHandle*>& outputs = workingMemDescriptor.m_Outputs;
+
+    std::unique_ptr<Decoder<InType>> input0 = MakeDecoder<InType>(GetTensorInfo(inputs[0]), inputs[0]->Map());
+    std::unique_ptr<Decoder<InType>> input1 = MakeDecoder<InType>(GetTensorInfo(inputs[1]), inputs[1]->Map());
+    std::unique_ptr<Encoder<OutType>> output = MakeEncoder<OutType>(GetTensorInfo(outputs[0]), outputs[0]->Map());
+
+    Execute(inputs, outputs, *input0, *input1, *output);
+}
+
+void RefComparisonWorkload::Execute(const std::vector<ITensorHandle*>& inputs,
+                                    const std::vector<ITensorHandle*>& outputs,
+                                    Decoder<InType>& input0,
+                                    Decoder<InType>& input1,
+                                    Encoder<OutType>& output) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefComparisonWorkload_Execute");
 
-    const TensorInfo& inputInfo0 = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& inputInfo1 = GetTensorInfo(m_Data.m_Inputs[1]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    const TensorInfo& inputInfo0 = GetTensorInfo(inputs[0]);
+    const TensorInfo& inputInfo1 = GetTensorInfo(inputs[1]);
+    const TensorInfo& outputInfo = GetTensorInfo(outputs[0]);
 
     const TensorShape& inShape0 = inputInfo0.GetShape();
     const TensorShape& inShape1 = inputInfo1.GetShape();
     const TensorShape& outShape = outputInfo.GetShape();
 
-    m_Input0->Reset(m_Data.m_Inputs[0]->Map());
-    m_Input1->Reset(m_Data.m_Inputs[1]->Map());
-    m_Output->Reset(m_Data.m_Outputs[0]->Map());
-
     using EqualFunction          = ElementwiseFunction<std::equal_to<InType>>;
     using GreaterFunction        = ElementwiseFunction<std::greater<InType>>;
     using GreaterOrEqualFunction = ElementwiseFunction<std::greater_equal<InType>>;
@@ -63,32 +84,32 @@ void RefComparisonWorkload::Execute() const
     {
         case ComparisonOperation::Equal:
         {
-            EqualFunction(inShape0, inShape1, outShape, *m_Input0, *m_Input1, *m_Output);
+            EqualFunction(inShape0, inShape1, outShape, input0, input1, output);
             break;
         }
         case ComparisonOperation::Greater:
         {
-            GreaterFunction(inShape0, inShape1, outShape, *m_Input0, *m_Input1, *m_Output);
+            GreaterFunction(inShape0, inShape1, outShape, input0, input1, output);
             break;
         }
         case ComparisonOperation::GreaterOrEqual:
         {
-            GreaterOrEqualFunction(inShape0, inShape1, outShape, *m_Input0, *m_Input1, *m_Output);
+            GreaterOrEqualFunction(inShape0, inShape1, outShape, input0, input1, output);
             break;
         }
         case ComparisonOperation::Less:
         {
-            LessFunction(inShape0, inShape1, outShape, *m_Input0, *m_Input1, *m_Output);
+            LessFunction(inShape0, inShape1, outShape, input0, input1, output);
             break;
         }
         case ComparisonOperation::LessOrEqual:
         {
-            LessOrEqualFunction(inShape0, inShape1, outShape, *m_Input0, *m_Input1, *m_Output);
+            LessOrEqualFunction(inShape0, inShape1, outShape, input0, input1, output);
             break;
         }
         case ComparisonOperation::NotEqual:
         {
-            NotEqualFunction(inShape0, inShape1, outShape, *m_Input0, *m_Input1, *m_Output);
+            NotEqualFunction(inShape0, inShape1, outShape, input0, input1, output);
             break;
         }
         default:
@@ -38,4 +38,17 @@ void RefConstantWorkload::Execute() const
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefConstantWorkload_Execute");
 }
 
+void RefConstantWorkload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefConstantWorkload_Execute");
+
+    // Working memory is not filled at allocation time the way the workload's own output is,
+    // so the constant data is written on every execution.
+    ITensorHandle* output = workingMemDescriptor.m_Outputs[0];
+    BOOST_ASSERT(m_Data.m_LayerOutput->GetTensorInfo().GetNumBytes() == GetTensorInfo(output).GetNumBytes());
+
+    memcpy(GetOutputTensorData<void>(output), m_Data.m_LayerOutput->GetConstTensor<void>(),
+        GetTensorInfo(output).GetNumBytes());
+}
+
 } //namespace armnn
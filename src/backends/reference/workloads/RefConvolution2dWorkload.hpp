@@ -9,6 +9,7 @@
 #include <backendsCommon/WorkloadData.hpp>
 #include "Decoders.hpp"
 #include "Encoders.hpp"
+#include "RefThreadPool.hpp"
 
 namespace armnn
 {
@@ -16,14 +17,21 @@ namespace armnn
 class RefConvolution2dWorkload : public BaseWorkload<Convolution2dQueueDescriptor>
 {
 public:
-    explicit RefConvolution2dWorkload(const Convolution2dQueueDescriptor& descriptor,
-                                      const WorkloadInfo& info);
+    RefConvolution2dWorkload(const Convolution2dQueueDescriptor& descriptor,
+                             const WorkloadInfo& info,
+                             std::shared_ptr<RefThreadPool> threadPool);
 
     void PostAllocationConfigure() override;
 
-    virtual void Execute() const override;
+    void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
 
 private:
+    void Execute(Decoder<float>& inputDecoder,
+                 Encoder<float>& outputEncoder,
+                 Decoder<float>& filterDecoder,
+                 Decoder<float>* biasDecoder) const;
+
     std::unique_ptr<ScopedCpuTensorHandle> m_Weight;
     std::unique_ptr<ScopedCpuTensorHandle> m_Bias;
 
@@ -35,6 +43,8 @@ private:
     TensorShape m_InputShape;
     TensorShape m_OutputShape;
     TensorShape m_FilterShape;
+
+    std::shared_ptr<RefThreadPool> m_ThreadPool;
 };
 
 } //namespace armnn
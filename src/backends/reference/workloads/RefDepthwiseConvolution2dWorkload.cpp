@@ -16,8 +16,11 @@ namespace armnn
 {
 
 RefDepthwiseConvolution2dWorkload::RefDepthwiseConvolution2dWorkload(
-        const DepthwiseConvolution2dQueueDescriptor& descriptor, const WorkloadInfo& info)
+        const DepthwiseConvolution2dQueueDescriptor& descriptor,
+        const WorkloadInfo& info,
+        std::shared_ptr<RefThreadPool> threadPool)
         : BaseWorkload<DepthwiseConvolution2dQueueDescriptor>(descriptor, info)
+        , m_ThreadPool(std::move(threadPool))
 {
     m_Weight = std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight));
     const TensorInfo& rFilterInfo = m_Weight->GetTensorInfo();
@@ -45,14 +48,38 @@ void RefDepthwiseConvolution2dWorkload::PostAllocationConfigure()
 
 void RefDepthwiseConvolution2dWorkload::Execute() const
 {
-    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefDepthwiseConvolution2dWorkload_Execute");
-    std::unique_ptr<Decoder<float>> pBiasDecoder{};
-
     m_InputDecoder->Reset(m_Data.m_Inputs[0]->Map());
     m_OutputEncoder->Reset(m_Data.m_Outputs[0]->Map());
 
-    Convolve(m_InputShape, *m_InputDecoder, m_OutputShape, *m_OutputEncoder,
-             m_FilterShape, *m_FilterDecoder, m_Data.m_Parameters.m_BiasEnabled, m_BiasDecoder.get(),
+    Execute(*m_InputDecoder, *m_OutputEncoder, *m_FilterDecoder, m_BiasDecoder.get());
+}
+
+void RefDepthwiseConvolution2dWorkload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    ITensorHandle* input  = workingMemDescriptor.m_Inputs[0];
+    ITensorHandle* output = workingMemDescriptor.m_Outputs[0];
+
+    std::unique_ptr<Decoder<float>> inputDecoder  = MakeDecoder<float>(GetTensorInfo(input), input->Map());
+    std::unique_ptr<Encoder<float>> outputEncoder = MakeEncoder<float>(GetTensorInfo(output), output->Map());
+    std::unique_ptr<Decoder<float>> filterDecoder = MakeDecoder<float>(m_Weight->GetTensorInfo(), m_Weight->Map(true));
+    std::unique_ptr<Decoder<float>> biasDecoder;
+    if (m_Data.m_Parameters.m_BiasEnabled)
+    {
+        biasDecoder = MakeDecoder<float>(m_Bias->GetTensorInfo(), m_Bias->Map(true));
+    }
+
+    Execute(*inputDecoder, *outputEncoder, *filterDecoder, biasDecoder.get());
+}
+
+void RefDepthwiseConvolution2dWorkload::Execute(Decoder<float>& inputDecoder,
+                                                Encoder<float>& outputEncoder,
+                                                Decoder<float>& filterDecoder,
+                                                Decoder<float>* biasDecoder) const
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefDepthwiseConvolution2dWorkload_Execute");
+
+    Convolve(*m_ThreadPool, m_InputShape, inputDecoder, m_OutputShape, outputEncoder,
+             m_FilterShape, filterDecoder, m_Data.m_Parameters.m_BiasEnabled, biasDecoder,
              m_Data.m_Parameters.m_DataLayout, m_Data.m_Parameters.m_PadTop, m_Data.m_Parameters.m_PadLeft,
              m_Data.m_Parameters.m_StrideX, m_Data.m_Parameters.m_StrideY,
              m_Data.m_Parameters.m_DilationX,
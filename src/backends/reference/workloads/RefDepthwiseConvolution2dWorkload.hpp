@@ -6,6 +6,7 @@
 #include <backendsCommon/WorkloadData.hpp>
 #include "Decoders.hpp"
 #include "Encoders.hpp"
+#include "RefThreadPool.hpp"
 
 #include <armnn/TypesUtils.hpp>
 
@@ -14,14 +15,20 @@ namespace armnn
 
 class RefDepthwiseConvolution2dWorkload : public BaseWorkload<DepthwiseConvolution2dQueueDescriptor> {
 public:
-    explicit RefDepthwiseConvolution2dWorkload(const DepthwiseConvolution2dQueueDescriptor &descriptor,
-                                               const WorkloadInfo &info);
+    RefDepthwiseConvolution2dWorkload(const DepthwiseConvolution2dQueueDescriptor &descriptor,
+                                      const WorkloadInfo &info,
+                                      std::shared_ptr<RefThreadPool> threadPool);
 
     void PostAllocationConfigure() override;
 
-    virtual void Execute() const override;
+    void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
 
 private:
+    void Execute(Decoder<float>& inputDecoder,
+                 Encoder<float>& outputEncoder,
+                 Decoder<float>& filterDecoder,
+                 Decoder<float>* biasDecoder) const;
 
     std::unique_ptr <ScopedCpuTensorHandle> m_Weight;
     std::unique_ptr <ScopedCpuTensorHandle> m_Bias;
@@ -34,6 +41,8 @@ private:
     TensorShape m_InputShape;
     TensorShape m_OutputShape;
     TensorShape m_FilterShape;
+
+    std::shared_ptr<RefThreadPool> m_ThreadPool;
 };
 
 } //namespace armnn
@@ -28,8 +28,15 @@ public:
     RefElementwiseWorkload(const ParentDescriptor& descriptor, const WorkloadInfo& info);
     void PostAllocationConfigure() override;
     void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
 
 private:
+    void Execute(const std::vector<ITensorHandle*>& inputs,
+                 const std::vector<ITensorHandle*>& outputs,
+                 Decoder<InType>& input0,
+                 Decoder<InType>& input1,
+                 Encoder<OutType>& output) const;
+
     std::unique_ptr<Decoder<InType>> m_Input0;
     std::unique_ptr<Decoder<InType>> m_Input1;
     std::unique_ptr<Encoder<OutType>> m_Output;
@@ -13,9 +13,12 @@
 namespace armnn
 {
 RefFullyConnectedWorkload::RefFullyConnectedWorkload(
-    const FullyConnectedQueueDescriptor& descriptor, const WorkloadInfo& info)
+    const FullyConnectedQueueDescriptor& descriptor,
+    const WorkloadInfo& info,
+    std::shared_ptr<RefThreadPool> threadPool)
         : BaseWorkload<FullyConnectedQueueDescriptor>(descriptor, info),
-          m_Weight(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight)))
+          m_Weight(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight))),
+          m_ThreadPool(std::move(threadPool))
 {
     const TensorInfo& rWeightInfo = m_Weight->GetTensorInfo();
     m_WeightShape = rWeightInfo.GetShape();
@@ -49,17 +52,43 @@ void RefFullyConnectedWorkload::PostAllocationConfigure()
 
 void RefFullyConnectedWorkload::Execute() const
 {
-    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefFullyConnectedWorkload_Execute");
-
     m_InputDecoder->Reset(m_Data.m_Inputs[0]->Map());
     m_OutputEncoder->Reset(m_Data.m_Outputs[0]->Map());
 
-    FullyConnected(m_InputShape,
-                   *m_InputDecoder,
+    Execute(*m_InputDecoder, *m_OutputEncoder, *m_WeightDecoder, m_BiasDecoder.get());
+}
+
+void RefFullyConnectedWorkload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    ITensorHandle* input  = workingMemDescriptor.m_Inputs[0];
+    ITensorHandle* output = workingMemDescriptor.m_Outputs[0];
+
+    std::unique_ptr<Decoder<float>> inputDecoder  = MakeDecoder<float>(GetTensorInfo(input), input->Map());
+    std::unique_ptr<Encoder<float>> outputEncoder = MakeEncoder<float>(GetTensorInfo(output), output->Map());
+    std::unique_ptr<Decoder<float>> weightDecoder = MakeDecoder<float>(m_Weight->GetTensorInfo(), m_Weight->Map(true));
+    std::unique_ptr<Decoder<float>> biasDecoder;
+    if (m_Data.m_Parameters.m_BiasEnabled)
+    {
+        biasDecoder = MakeDecoder<float>(m_Bias->GetTensorInfo(), m_Bias->Map(true));
+    }
+
+    Execute(*inputDecoder, *outputEncoder, *weightDecoder, biasDecoder.get());
+}
+
+void RefFullyConnectedWorkload::Execute(Decoder<float>& inputDecoder,
+                                        Encoder<float>& outputEncoder,
+                                        Decoder<float>& weightDecoder,
+                                        Decoder<float>* biasDecoder) const
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefFullyConnectedWorkload_Execute");
+
+    FullyConnected(*m_ThreadPool,
+                   m_InputShape,
+                   inputDecoder,
                    m_OutputShape,
-                   *m_OutputEncoder,
-                   *m_WeightDecoder,
-                   *m_BiasDecoder,
+                   outputEncoder,
+                   weightDecoder,
+                   *biasDecoder,
                    m_Data.m_Parameters.m_BiasEnabled,
                    m_NumActivations,
                    m_Data.m_Parameters.m_TransposeWeightMatrix);
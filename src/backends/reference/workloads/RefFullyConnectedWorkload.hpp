@@ -10,6 +10,7 @@
 #include "BaseIterator.hpp"
 #include "Decoders.hpp"
 #include "Encoders.hpp"
+#include "RefThreadPool.hpp"
 
 
 namespace armnn
@@ -18,14 +19,21 @@ namespace armnn
 class RefFullyConnectedWorkload : public BaseWorkload<FullyConnectedQueueDescriptor>
 {
 public:
-    explicit RefFullyConnectedWorkload(const FullyConnectedQueueDescriptor& descriptor,
-                                       const WorkloadInfo& info);
+    RefFullyConnectedWorkload(const FullyConnectedQueueDescriptor& descriptor,
+                              const WorkloadInfo& info,
+                              std::shared_ptr<RefThreadPool> threadPool);
 
     void PostAllocationConfigure() override;
 
-    virtual void Execute() const override;
+    void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
 
 private:
+    void Execute(Decoder<float>& inputDecoder,
+                 Encoder<float>& outputEncoder,
+                 Decoder<float>& weightDecoder,
+                 Decoder<float>* biasDecoder) const;
+
     std::unique_ptr<ScopedCpuTensorHandle> m_Weight;
     std::unique_ptr<ScopedCpuTensorHandle> m_Bias;
 
@@ -38,6 +46,8 @@ private:
     TensorShape m_OutputShape;
     TensorShape m_WeightShape;
     unsigned int m_NumActivations;
+
+    std::shared_ptr<RefThreadPool> m_ThreadPool;
 };
 
 } //namespace armnn
@@ -21,6 +21,10 @@ class RefGatherWorkload : public BaseWorkload<GatherQueueDescriptor>
 public:
     using BaseWorkload<GatherQueueDescriptor>::BaseWorkload;
     void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const std::vector<ITensorHandle*>& inputs, const std::vector<ITensorHandle*>& outputs) const;
 };
 
 } // namespace armnn
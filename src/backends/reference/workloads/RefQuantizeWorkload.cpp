@@ -38,8 +38,19 @@ RefQuantizeWorkload::RefQuantizeWorkload(const QuantizeQueueDescriptor& descript
 
 void RefQuantizeWorkload::Execute() const
 {
-    const void* input = m_Data.m_Inputs[0]->Map(true);
-    void* output =  m_Data.m_Outputs[0]->Map(true);
+    Execute(m_Data.m_Inputs, m_Data.m_Outputs);
+}
+
+void RefQuantizeWorkload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(workingMemDescriptor.m_Inputs, workingMemDescriptor.m_Outputs);
+}
+
+void RefQuantizeWorkload::Execute(const std::vector<ITensorHandle*>& inputs,
+                                  const std::vector<ITensorHandle*>& outputs) const
+{
+    const void* input = inputs[0]->Map(true);
+    void* output =  outputs[0]->Map(true);
 
     switch(m_TargetType)
     {
@@ -59,8 +70,8 @@ void RefQuantizeWorkload::Execute() const
         }
     }
 
-    m_Data.m_Inputs[0]->Unmap();
-    m_Data.m_Outputs[0]->Unmap();
+    inputs[0]->Unmap();
+    outputs[0]->Unmap();
 }
 
 } //namespace armnn
\ No newline at end of file
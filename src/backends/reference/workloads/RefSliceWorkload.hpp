@@ -16,7 +16,11 @@ class RefSliceWorkload : public BaseWorkload<SliceQueueDescriptor>
 public:
     using BaseWorkload<SliceQueueDescriptor>::BaseWorkload;
 
-    virtual void Execute() const override;
+    void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const std::vector<ITensorHandle*>& inputs, const std::vector<ITensorHandle*>& outputs) const;
 };
 
 } // namespace armnn
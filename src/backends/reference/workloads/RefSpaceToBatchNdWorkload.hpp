@@ -16,6 +16,10 @@ class RefSpaceToBatchNdWorkload : public BaseWorkload<SpaceToBatchNdQueueDescrip
 public:
     using BaseWorkload<SpaceToBatchNdQueueDescriptor>::BaseWorkload;
     void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const std::vector<ITensorHandle*>& inputs, const std::vector<ITensorHandle*>& outputs) const;
 };
 
 } //namespace armnn
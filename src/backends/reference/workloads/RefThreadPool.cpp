@@ -0,0 +1,156 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "RefThreadPool.hpp"
+
+#include <algorithm>
+#include <exception>
+
+namespace armnn
+{
+
+namespace
+{
+
+unsigned int ResolveNumThreads(unsigned int numThreads)
+{
+    return numThreads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : numThreads;
+}
+
+} // anonymous namespace
+
+RefThreadPool::RefThreadPool(unsigned int numThreads)
+    : m_NumThreads(ResolveNumThreads(numThreads))
+    , m_Stopping(false)
+{
+    // The thread calling ParallelFor() is one of the threads doing the work.
+    for (unsigned int i = 1; i < m_NumThreads; ++i)
+    {
+        m_Workers.emplace_back(&RefThreadPool::ProcessTasks, this);
+    }
+}
+
+RefThreadPool::~RefThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_TaskAvailable.notify_all();
+
+    for (auto& worker : m_Workers)
+    {
+        worker.join();
+    }
+}
+
+unsigned int RefThreadPool::GetNumRanges(unsigned int numItems, unsigned int minItemsPerRange) const
+{
+    return std::max(1u, std::min(m_NumThreads, numItems / std::max(1u, minItemsPerRange)));
+}
+
+void RefThreadPool::ParallelFor(unsigned int numItems,
+                                unsigned int minItemsPerRange,
+                                const std::function<void(unsigned int, unsigned int)>& work)
+{
+    ParallelForEachRange(numItems, GetNumRanges(numItems, minItemsPerRange),
+                         [&work](unsigned int, unsigned int begin, unsigned int end) { work(begin, end); });
+}
+
+void RefThreadPool::ParallelForEachRange(unsigned int numItems,
+                                         unsigned int numRanges,
+                                         const std::function<void(unsigned int, unsigned int, unsigned int)>& work)
+{
+    if (numRanges <= 1)
+    {
+        work(0, 0, numItems);
+        return;
+    }
+
+    const unsigned int rangeSize = numItems / numRanges;
+    const unsigned int remainder = numItems % numRanges;
+    auto rangeBegin = [&](unsigned int range) { return range * rangeSize + std::min(range, remainder); };
+
+    unsigned int numPending = numRanges - 1;
+    std::exception_ptr error;
+
+    auto runRange = [&](unsigned int range)
+    {
+        try
+        {
+            work(range, rangeBegin(range), rangeBegin(range + 1));
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+    };
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for (unsigned int range = 1; range < numRanges; ++range)
+        {
+            m_Tasks.emplace_back([&, range]()
+            {
+                runRange(range);
+
+                std::lock_guard<std::mutex> taskLock(m_Mutex);
+                --numPending;
+                m_TaskFinished.notify_all();
+            });
+        }
+    }
+    m_TaskAvailable.notify_all();
+
+    runRange(0);
+
+    // Helps with the queued tasks rather than only waiting, so the ranges get done even if the workers are busy
+    // with other calls.
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (numPending > 0)
+    {
+        if (m_Tasks.empty())
+        {
+            m_TaskFinished.wait(lock);
+            continue;
+        }
+
+        std::function<void()> task = std::move(m_Tasks.front());
+        m_Tasks.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+void RefThreadPool::ProcessTasks()
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true)
+    {
+        m_TaskAvailable.wait(lock, [this] { return m_Stopping || !m_Tasks.empty(); });
+        if (m_Tasks.empty())
+        {
+            return;
+        }
+
+        std::function<void()> task = std::move(m_Tasks.front());
+        m_Tasks.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+
+} // namespace armnn
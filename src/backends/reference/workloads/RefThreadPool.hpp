@@ -0,0 +1,67 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace armnn
+{
+
+/// Number of multiply-accumulates below which handing a range of a kernel's work to another thread costs more
+/// than it saves.
+constexpr unsigned int g_MinMacsPerParallelRange = 16384;
+
+/// Pool of threads the reference workloads split their most expensive kernels across. Each runtime owns one, sized
+/// from IRuntime::CreationOptions::m_CpuRefNumThreads, which its RefBackendContext hands to the workload factories of
+/// the networks it loads.
+class RefThreadPool
+{
+public:
+    /// numThreads is the number of threads used by ParallelFor(), the calling thread included.
+    /// 0 means one per hardware thread.
+    explicit RefThreadPool(unsigned int numThreads = 1);
+
+    ~RefThreadPool();
+
+    unsigned int GetNumThreads() const { return m_NumThreads; }
+
+    /// Returns the number of ranges ParallelFor() splits [0, numItems) into: at most GetNumThreads(), each of at
+    /// least minItemsPerRange items.
+    unsigned int GetNumRanges(unsigned int numItems, unsigned int minItemsPerRange) const;
+
+    /// Splits [0, numItems) into GetNumRanges(numItems, minItemsPerRange) contiguous ranges and calls
+    /// work(begin, end) for each of them, returning once they are all done.
+    void ParallelFor(unsigned int numItems,
+                     unsigned int minItemsPerRange,
+                     const std::function<void(unsigned int, unsigned int)>& work);
+
+    /// Splits [0, numItems) into numRanges contiguous ranges and calls work(range, begin, end) for each of them,
+    /// returning once they are all done. Any state a range needs of its own can be set up for every range before
+    /// the call. The calling thread processes the first range, so this can be called from several threads at once.
+    void ParallelForEachRange(unsigned int numItems,
+                              unsigned int numRanges,
+                              const std::function<void(unsigned int, unsigned int, unsigned int)>& work);
+
+private:
+    void ProcessTasks();
+
+    const unsigned int m_NumThreads;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_TaskAvailable;
+    std::condition_variable m_TaskFinished;
+    std::deque<std::function<void()>> m_Tasks;
+    bool m_Stopping;
+
+    std::vector<std::thread> m_Workers;
+};
+
+} // namespace armnn
@@ -52,19 +52,45 @@ void RefTransposeConvolution2dWorkload::PostAllocationConfigure()
 
 void RefTransposeConvolution2dWorkload::Execute() const
 {
-    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefTransposeConvolution2dWorkload_Execute");
-
     m_InputDecoder->Reset(m_Data.m_Inputs[0]->Map());
     m_OutputEncoder->Reset(m_Data.m_Outputs[0]->Map());
 
+    Execute(*m_InputDecoder, *m_OutputEncoder, *m_WeightsDecoder, m_BiasesDecoder.get());
+}
+
+void RefTransposeConvolution2dWorkload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    ITensorHandle* input  = workingMemDescriptor.m_Inputs[0];
+    ITensorHandle* output = workingMemDescriptor.m_Outputs[0];
+
+    std::unique_ptr<Decoder<float>> inputDecoder   = MakeDecoder<float>(GetTensorInfo(input), input->Map());
+    std::unique_ptr<Encoder<float>> outputEncoder  = MakeEncoder<float>(GetTensorInfo(output), output->Map());
+    std::unique_ptr<Decoder<float>> weightsDecoder = MakeDecoder<float>(m_Weights->GetTensorInfo(),
+                                                                        m_Weights->Map(true));
+    std::unique_ptr<Decoder<float>> biasesDecoder;
+    if (m_Data.m_Parameters.m_BiasEnabled)
+    {
+        biasesDecoder = MakeDecoder<float>(m_Biases->GetTensorInfo(), m_Biases->Map(true));
+    }
+
+    Execute(*inputDecoder, *outputEncoder, *weightsDecoder, biasesDecoder.get());
+}
+
+void RefTransposeConvolution2dWorkload::Execute(Decoder<float>& inputDecoder,
+                                                Encoder<float>& outputEncoder,
+                                                Decoder<float>& weightsDecoder,
+                                                Decoder<float>* biasesDecoder) const
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefTransposeConvolution2dWorkload_Execute");
+
     TransposeConvolution2dImpl(m_Data.m_Parameters,
                                m_InputShape,
-                               *m_InputDecoder,
+                               inputDecoder,
                                m_OutputShape,
-                               *m_OutputEncoder,
+                               outputEncoder,
                                m_WeightsShape,
-                               *m_WeightsDecoder,
-                               m_BiasesDecoder.get());
+                               weightsDecoder,
+                               biasesDecoder);
 }
 
 } // namespace armnn
\ No newline at end of file
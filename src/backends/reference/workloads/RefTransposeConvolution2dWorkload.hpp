@@ -24,8 +24,14 @@ public:
     void PostAllocationConfigure() override;
 
     void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
 
 private:
+    void Execute(Decoder<float>& inputDecoder,
+                 Encoder<float>& outputEncoder,
+                 Decoder<float>& weightsDecoder,
+                 Decoder<float>* biasesDecoder) const;
+
     std::unique_ptr<ScopedCpuTensorHandle> m_Weights;
     std::unique_ptr<ScopedCpuTensorHandle> m_Biases;
 
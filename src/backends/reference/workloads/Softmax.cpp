@@ -5,6 +5,8 @@
 
 #include "Softmax.hpp"
 
+#include "IteratorDispatch.hpp"
+
 #include <TensorUtils.hpp>
 
 #include <cmath>
@@ -13,25 +15,17 @@
 namespace armnn
 {
 
-/// Computes the softmax function on some inputs, into outputs, with a shape given by tensorInfo.
-void Softmax(Decoder<float>& in, Encoder<float>& out, const TensorInfo& inputTensorInfo, float beta, int axis)
+namespace
 {
-    BOOST_ASSERT_MSG(axis < static_cast<int>(inputTensorInfo.GetNumDimensions()),
-                     "Required axis index greater than number of dimensions.");
-    BOOST_ASSERT_MSG(axis >= -static_cast<int>(inputTensorInfo.GetNumDimensions()),
-                     "Required axis index lower than negative of the number of dimensions");
-
-    unsigned int uAxis = axis < 0  ?
-                         inputTensorInfo.GetNumDimensions() - static_cast<unsigned int>(abs(axis))
-                         : static_cast<unsigned int>(axis);
-
-    const TensorShape& inputShape = inputTensorInfo.GetShape();
-    const unsigned int outerSize  = armnnUtils::GetNumElementsBetween(inputShape, 0, uAxis);
-    const unsigned int axisSize   = inputShape[uAxis];
-    const unsigned int innerSize  = armnnUtils::GetNumElementsBetween(inputShape,
-                                                                      uAxis + 1,
-                                                                      inputShape.GetNumDimensions());
 
+template<typename DecoderType, typename EncoderType>
+void SoftmaxImpl(DecoderType& in,
+                 EncoderType& out,
+                 unsigned int outerSize,
+                 unsigned int axisSize,
+                 unsigned int innerSize,
+                 float beta)
+{
     for (unsigned int outer = 0; outer < outerSize; ++outer)
     {
         unsigned int inputBeginIdx  = outer * axisSize * innerSize;
@@ -69,4 +63,31 @@ void Softmax(Decoder<float>& in, Encoder<float>& out, const TensorInfo& inputTen
     }
 }
 
+} // anonymous namespace
+
+/// Computes the softmax function on some inputs, into outputs, with a shape given by tensorInfo.
+void Softmax(Decoder<float>& in, Encoder<float>& out, const TensorInfo& inputTensorInfo, float beta, int axis)
+{
+    BOOST_ASSERT_MSG(axis < static_cast<int>(inputTensorInfo.GetNumDimensions()),
+                     "Required axis index greater than number of dimensions.");
+    BOOST_ASSERT_MSG(axis >= -static_cast<int>(inputTensorInfo.GetNumDimensions()),
+                     "Required axis index lower than negative of the number of dimensions");
+
+    unsigned int uAxis = axis < 0  ?
+                         inputTensorInfo.GetNumDimensions() - static_cast<unsigned int>(abs(axis))
+                         : static_cast<unsigned int>(axis);
+
+    const TensorShape& inputShape = inputTensorInfo.GetShape();
+    const unsigned int outerSize  = armnnUtils::GetNumElementsBetween(inputShape, 0, uAxis);
+    const unsigned int axisSize   = inputShape[uAxis];
+    const unsigned int innerSize  = armnnUtils::GetNumElementsBetween(inputShape,
+                                                                      uAxis + 1,
+                                                                      inputShape.GetNumDimensions());
+
+    DispatchTypedIterators(in, out, [&](auto& typedIn, auto& typedOut)
+    {
+        SoftmaxImpl(typedIn, typedOut, outerSize, axisSize, innerSize, beta);
+    });
+}
+
 } //namespace armnn
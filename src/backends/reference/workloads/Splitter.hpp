@@ -78,5 +78,7 @@ void Splitter(const SplitterQueueDescriptor& data)
     }
 }
 
-void Split(const SplitterQueueDescriptor& data);
+void Split(const SplitterQueueDescriptor& data,
+           const std::vector<ITensorHandle*>& inputs,
+           const std::vector<ITensorHandle*>& outputs);
 } //namespace armnn
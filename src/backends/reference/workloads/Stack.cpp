@@ -11,10 +11,10 @@ namespace armnn
 
 void Stack(const StackQueueDescriptor& data,
            std::vector<std::unique_ptr<Decoder<float>>>& inputs,
-           Encoder<float>& output)
+           Encoder<float>& output,
+           const TensorInfo& inputInfo,
+           const TensorInfo& outputInfo)
 {
-    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
-    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
 
     unsigned int outputNumDims = outputInfo.GetNumDimensions();
     unsigned int inputNumDims = inputInfo.GetNumDimensions();
@@ -31,7 +31,7 @@ void Stack(const StackQueueDescriptor& data,
         numOutputElements *= outputDims[i];
     }
 
-    const unsigned int iNumTensors = static_cast<unsigned int>(data.m_Inputs.size());
+    const unsigned int iNumTensors = static_cast<unsigned int>(inputs.size());
     const unsigned int iBatchSize  = inputDims[0];
     const unsigned int iChannels   = (inputNumDims > 1) ? inputDims[1] : 1;
     const unsigned int iHeight     = (inputNumDims > 2) ? inputDims[2] : 1;
@@ -0,0 +1,253 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+// Measures how the inference throughput of a single loaded network scales with the number of threads running it,
+// comparing IRuntime::EnqueueWorkload(), which has to be called by one thread at a time, with IRuntime::Execute()
+// given one working memory handle per thread.
+
+#include <armnn/ArmNN.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+namespace po = boost::program_options;
+
+// A small convolutional network: numLayers x (3x3 Convolution2d + ReLu), NHWC.
+armnn::INetworkPtr CreateNetwork(unsigned int size, unsigned int channels, unsigned int numLayers)
+{
+    using namespace armnn;
+
+    TensorInfo tensorInfo({ 1, size, size, channels }, DataType::Float32);
+    TensorInfo weightsInfo({ channels, 3, 3, channels }, DataType::Float32);
+    TensorInfo biasInfo({ channels }, DataType::Float32);
+
+    std::vector<float> weights(weightsInfo.GetNumElements());
+    for (size_t i = 0; i < weights.size(); ++i)
+    {
+        weights[i] = static_cast<float>(static_cast<int>(i % 7) - 3) * 0.05f;
+    }
+    std::vector<float> biases(biasInfo.GetNumElements(), 0.1f);
+
+    Convolution2dDescriptor convDesc;
+    convDesc.m_PadLeft     = 1;
+    convDesc.m_PadRight    = 1;
+    convDesc.m_PadTop      = 1;
+    convDesc.m_PadBottom   = 1;
+    convDesc.m_StrideX     = 1;
+    convDesc.m_StrideY     = 1;
+    convDesc.m_BiasEnabled = true;
+    convDesc.m_DataLayout  = DataLayout::NHWC;
+
+    ActivationDescriptor activationDesc;
+    activationDesc.m_Function = ActivationFunction::ReLu;
+
+    INetworkPtr net(INetwork::Create());
+
+    IConnectableLayer* previous = net->AddInputLayer(0);
+    previous->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    for (unsigned int i = 0; i < numLayers; ++i)
+    {
+        IConnectableLayer* conv = net->AddConvolution2dLayer(convDesc,
+                                                             ConstTensor(weightsInfo, weights),
+                                                             Optional<ConstTensor>(ConstTensor(biasInfo, biases)));
+        IConnectableLayer* activation = net->AddActivationLayer(activationDesc);
+
+        previous->GetOutputSlot(0).Connect(conv->GetInputSlot(0));
+        conv->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+        conv->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+        activation->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+        previous = activation;
+    }
+
+    IConnectableLayer* output = net->AddOutputLayer(0);
+    previous->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    return net;
+}
+
+std::vector<unsigned int> ParseThreadCounts(const std::string& threadCounts)
+{
+    std::vector<unsigned int> result;
+    std::stringstream ss(threadCounts);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        const int count = std::stoi(item);
+        if (count > 0)
+        {
+            result.push_back(static_cast<unsigned int>(count));
+        }
+    }
+    return result;
+}
+
+// Runs numThreads threads each performing numIterations inferences and returns the elapsed time in seconds.
+template <typename InferenceFunction>
+double RunThreads(unsigned int numThreads, unsigned int numIterations, InferenceFunction inference)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back([&, t]()
+        {
+            for (unsigned int i = 0; i < numIterations; ++i)
+            {
+                inference(t);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    using namespace armnn;
+
+    std::string threadCountsStr;
+    unsigned int numIterations = 0;
+    unsigned int size = 0;
+    unsigned int channels = 0;
+    unsigned int numLayers = 0;
+
+    po::options_description desc("Options");
+    desc.add_options()
+        ("help,h", "Display usage information")
+        ("threads,t", po::value<std::string>(&threadCountsStr)->default_value("1,2,4,8"),
+         "Comma separated list of the numbers of threads to measure")
+        ("iterations,i", po::value<unsigned int>(&numIterations)->default_value(20),
+         "Number of inferences run by each thread")
+        ("size,s", po::value<unsigned int>(&size)->default_value(32), "Height and width of the input")
+        ("channels,c", po::value<unsigned int>(&channels)->default_value(16), "Number of channels of each layer")
+        ("layers,l", po::value<unsigned int>(&numLayers)->default_value(4), "Number of convolution layers");
+
+    po::variables_map vm;
+    try
+    {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        if (vm.count("help"))
+        {
+            std::cout << desc << std::endl;
+            return EXIT_SUCCESS;
+        }
+        po::notify(vm);
+    }
+    catch (const po::error& e)
+    {
+        std::cerr << e.what() << std::endl << desc << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::vector<unsigned int> threadCounts = ParseThreadCounts(threadCountsStr);
+    if (threadCounts.empty() || numIterations == 0)
+    {
+        std::cerr << "At least one thread count and one iteration are needed" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    INetworkPtr net = CreateNetwork(size, channels, numLayers);
+    IOptimizedNetworkPtr optNet = Optimize(*net, { Compute::CpuRef }, runtime->GetDeviceSpec());
+    if (!optNet)
+    {
+        std::cerr << "Failed to optimize the network" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    NetworkId networkId;
+    if (runtime->LoadNetwork(networkId, std::move(optNet)) != Status::Success)
+    {
+        std::cerr << "Failed to load the network" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const TensorInfo inputInfo  = runtime->GetInputTensorInfo(networkId, 0);
+    const TensorInfo outputInfo = runtime->GetOutputTensorInfo(networkId, 0);
+
+    std::cout << "Network: " << numLayers << " x Convolution2d 3x3 + ReLu, input 1x" << size << "x" << size << "x"
+              << channels << ", " << numIterations << " inferences per thread, "
+              << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+    std::cout << std::setw(8) << "threads"
+              << std::setw(22) << "EnqueueWorkload inf/s"
+              << std::setw(22) << "Execute inf/s"
+              << std::setw(12) << "speedup"
+              << std::setw(18) << "working mem KiB" << std::endl;
+
+    double singleThreadThroughput = 0.0;
+    for (unsigned int numThreads : threadCounts)
+    {
+        std::vector<std::vector<float>> inputData(numThreads, std::vector<float>(inputInfo.GetNumElements(), 1.0f));
+        std::vector<std::vector<float>> outputData(numThreads, std::vector<float>(outputInfo.GetNumElements()));
+
+        auto makeInputs = [&](unsigned int t)
+        {
+            return InputTensors{ { 0, ConstTensor(inputInfo, inputData[t].data()) } };
+        };
+        auto makeOutputs = [&](unsigned int t)
+        {
+            return OutputTensors{ { 0, Tensor(outputInfo, outputData[t].data()) } };
+        };
+
+        std::mutex enqueueMutex;
+        const double enqueueSeconds = RunThreads(numThreads, numIterations, [&](unsigned int t)
+        {
+            std::lock_guard<std::mutex> lock(enqueueMutex);
+            runtime->EnqueueWorkload(networkId, makeInputs(t), makeOutputs(t));
+        });
+
+        std::vector<std::unique_ptr<IWorkingMemHandle>> workingMemHandles;
+        size_t workingMemBytes = 0;
+        for (unsigned int t = 0; t < numThreads; ++t)
+        {
+            workingMemHandles.push_back(runtime->CreateWorkingMemHandle(networkId));
+            workingMemBytes += workingMemHandles.back()->GetSizeInBytes();
+        }
+
+        const double executeSeconds = RunThreads(numThreads, numIterations, [&](unsigned int t)
+        {
+            runtime->Execute(*workingMemHandles[t], makeInputs(t), makeOutputs(t));
+        });
+
+        const double numInferences = static_cast<double>(numThreads * numIterations);
+        const double enqueueThroughput = numInferences / enqueueSeconds;
+        const double executeThroughput = numInferences / executeSeconds;
+        if (singleThreadThroughput == 0.0)
+        {
+            singleThreadThroughput = executeThroughput / numThreads;
+        }
+
+        std::cout << std::setw(8) << numThreads
+                  << std::setw(22) << std::fixed << std::setprecision(1) << enqueueThroughput
+                  << std::setw(22) << executeThroughput
+                  << std::setw(11) << std::setprecision(2) << executeThroughput / singleThreadThroughput << "x"
+                  << std::setw(18) << workingMemBytes / 1024 << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
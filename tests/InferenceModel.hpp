@@ -88,6 +88,7 @@ struct Params
     std::vector<std::string>        m_OutputBindings;
     std::vector<armnn::BackendId>   m_ComputeDevices;
     std::string                     m_DynamicBackendsPath;
+    std::string                     m_OptimizedNetworkCacheDirectory;
     size_t                          m_SubgraphId;
     bool                            m_IsModelBinary;
     bool                            m_VisualizePostOptimizationModel;
@@ -196,9 +197,7 @@ public:
                                                    errorCode %
                                                    CHECK_LOCATION().AsString()));
             }
-            std::ifstream file(params.m_ModelPath, std::ios::binary);
-
-            network = parser->CreateNetworkFromBinary(file);
+            network = parser->CreateNetworkFromBinaryFile(params.m_ModelPath.c_str());
         }
 
         unsigned int subgraphId = boost::numeric_cast<unsigned int>(params.m_SubgraphId);
@@ -403,6 +402,7 @@ public:
             armnn::OptimizerOptions options;
             options.m_ReduceFp32ToFp16 = params.m_EnableFp16TurboMode;
             options.m_Debug = params.m_PrintIntermediateLayers;
+            options.m_CacheDirectory = params.m_OptimizedNetworkCacheDirectory;
 
             optNet = armnn::Optimize(*network, params.m_ComputeDevices, m_Runtime->GetDeviceSpec(), options);
             if (!optNet)
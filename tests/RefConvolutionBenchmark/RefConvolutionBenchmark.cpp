@@ -0,0 +1,200 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+// Compares the direct and the im2col + GEMM implementations of the reference backend's Convolution2d and
+// DepthwiseConvolution2d kernels on layer shapes taken from ResNet-50 and MobileNet v1.
+
+#include <reference/workloads/ConvImpl.hpp>
+#include <reference/workloads/RefThreadPool.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+namespace po = boost::program_options;
+
+struct LayerShape
+{
+    std::string m_Name;
+    unsigned int m_InputSize;
+    unsigned int m_InputChannels;
+    unsigned int m_OutputChannels; // Depth multiplier for depthwise layers.
+    unsigned int m_FilterSize;
+    unsigned int m_Stride;
+    bool m_Depthwise;
+};
+
+const std::vector<LayerShape> g_LayerShapes =
+{
+    { "ResNet-50 conv1 7x7/2",           224,    3,   64, 7, 2, false },
+    { "ResNet-50 res2 1x1",               56,   64,   64, 1, 1, false },
+    { "ResNet-50 res2 3x3",               56,   64,   64, 3, 1, false },
+    { "ResNet-50 res3 3x3",               28,  128,  128, 3, 1, false },
+    { "ResNet-50 res4 3x3",               14,  256,  256, 3, 1, false },
+    { "ResNet-50 res5 3x3",                7,  512,  512, 3, 1, false },
+    { "MobileNet conv1 3x3/2",           224,    3,   32, 3, 2, false },
+    { "MobileNet dw 3x3 112x112x32",     112,   32,    1, 3, 1, true  },
+    { "MobileNet pw 1x1 112x112x32->64", 112,   32,   64, 1, 1, false },
+    { "MobileNet dw 3x3 56x56x128",       56,  128,    1, 3, 1, true  },
+    { "MobileNet pw 1x1 28x28x256->256",  28,  256,  256, 1, 1, false },
+    { "MobileNet dw 3x3 14x14x512",       14,  512,    1, 3, 1, true  },
+    { "MobileNet dw 3x3/2 14x14x1024",    14, 1024,    1, 3, 2, true  },
+};
+
+template<typename T>
+std::vector<T> MakeData(unsigned int numElements)
+{
+    std::vector<T> data(numElements);
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        data[i] = static_cast<T>((i * 7) % 13);
+    }
+    return data;
+}
+
+// Returns the average duration of a convolution in milliseconds.
+template<typename T>
+double MeasureConvolution(const LayerShape& layer,
+                          armnn::DataType dataType,
+                          armnn::ConvolutionMethod method,
+                          unsigned int numIterations,
+                          armnn::RefThreadPool& threadPool)
+{
+    using namespace armnn;
+
+    const unsigned int padding        = layer.m_FilterSize / 2;
+    const unsigned int outputSize     = (layer.m_InputSize + 2 * padding - layer.m_FilterSize) / layer.m_Stride + 1;
+    const unsigned int outputChannels = layer.m_Depthwise ? layer.m_InputChannels * layer.m_OutputChannels
+                                                          : layer.m_OutputChannels;
+
+    const TensorInfo inputInfo({ 1, layer.m_InputSize, layer.m_InputSize, layer.m_InputChannels },
+                               dataType, 0.05f, 10);
+    const TensorInfo outputInfo({ 1, outputSize, outputSize, outputChannels }, dataType, 0.5f, 10);
+    const TensorInfo filterInfo(layer.m_Depthwise ?
+                                    TensorShape({ layer.m_OutputChannels, layer.m_InputChannels,
+                                                  layer.m_FilterSize, layer.m_FilterSize }) :
+                                    TensorShape({ layer.m_OutputChannels, layer.m_FilterSize,
+                                                  layer.m_FilterSize, layer.m_InputChannels }),
+                                dataType, 0.02f, 6);
+    // Quantized layers have Signed32 biases, as produced by the converters, so that they can be computed with
+    // integer arithmetic.
+    const bool quantized = dataType == DataType::QuantisedAsymm8;
+    const TensorInfo biasInfo({ outputChannels }, quantized ? DataType::Signed32 : DataType::Float32,
+                              inputInfo.GetQuantizationScale() * filterInfo.GetQuantizationScale(), 0);
+
+    std::vector<T> input  = MakeData<T>(inputInfo.GetNumElements());
+    std::vector<T> filter = MakeData<T>(filterInfo.GetNumElements());
+    std::vector<float> floatBiases   = MakeData<float>(biasInfo.GetNumElements());
+    std::vector<int32_t> int32Biases = MakeData<int32_t>(biasInfo.GetNumElements());
+    void* biases = quantized ? static_cast<void*>(int32Biases.data()) : floatBiases.data();
+    std::vector<T> output(outputInfo.GetNumElements());
+
+    std::unique_ptr<Decoder<float>> inputDecoder  = MakeDecoder<float>(inputInfo, input.data());
+    std::unique_ptr<Encoder<float>> outputEncoder = MakeEncoder<float>(outputInfo, output.data());
+    std::unique_ptr<Decoder<float>> filterDecoder = MakeDecoder<float>(filterInfo, filter.data());
+    std::unique_ptr<Decoder<float>> biasDecoder   = MakeDecoder<float>(biasInfo, biases);
+
+    auto convolve = [&]()
+    {
+        Convolve(threadPool, inputInfo.GetShape(), *inputDecoder, outputInfo.GetShape(), *outputEncoder,
+                 filterInfo.GetShape(), *filterDecoder, true, biasDecoder.get(), DataLayout::NHWC,
+                 padding, padding, layer.m_Stride, layer.m_Stride, 1, 1, layer.m_Depthwise, method);
+    };
+
+    convolve();
+
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < numIterations; ++i)
+    {
+        convolve();
+    }
+    const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+
+    return elapsed.count() / numIterations;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    unsigned int numIterations = 0;
+    unsigned int numThreads = 0;
+    bool quantized = false;
+
+    po::options_description desc("Options");
+    desc.add_options()
+        ("help,h", "Display usage information")
+        ("iterations,i", po::value<unsigned int>(&numIterations)->default_value(3),
+         "Number of convolutions timed for each layer and method")
+        ("threads,t", po::value<unsigned int>(&numThreads)->default_value(1),
+         "Number of threads the kernels are split across, 0 for one per hardware thread")
+        ("quantized,q", po::bool_switch(&quantized), "Use QAsymm8 tensors instead of Float32");
+
+    po::variables_map vm;
+    try
+    {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        if (vm.count("help"))
+        {
+            std::cout << desc << std::endl;
+            return EXIT_SUCCESS;
+        }
+        po::notify(vm);
+    }
+    catch (const po::error& e)
+    {
+        std::cerr << e.what() << std::endl << desc << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (numIterations == 0)
+    {
+        std::cerr << "At least one iteration is needed" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    armnn::RefThreadPool threadPool(numThreads);
+
+    std::cout << (quantized ? "QAsymm8" : "Float32") << ", NHWC, "
+              << threadPool.GetNumThreads() << " thread(s), "
+              << numIterations << " convolutions per measurement" << std::endl;
+    std::cout << std::setw(34) << "layer" << std::setw(14) << "direct ms"
+              << std::setw(12) << "gemm ms" << std::setw(12) << "speedup" << std::endl;
+
+    for (const LayerShape& layer : g_LayerShapes)
+    {
+        double directMs = 0.0;
+        double gemmMs = 0.0;
+        if (quantized)
+        {
+            directMs = MeasureConvolution<uint8_t>(layer, armnn::DataType::QuantisedAsymm8,
+                                                   armnn::ConvolutionMethod::Direct, numIterations, threadPool);
+            gemmMs   = MeasureConvolution<uint8_t>(layer, armnn::DataType::QuantisedAsymm8,
+                                                   armnn::ConvolutionMethod::Gemm, numIterations, threadPool);
+        }
+        else
+        {
+            directMs = MeasureConvolution<float>(layer, armnn::DataType::Float32,
+                                                 armnn::ConvolutionMethod::Direct, numIterations, threadPool);
+            gemmMs   = MeasureConvolution<float>(layer, armnn::DataType::Float32,
+                                                 armnn::ConvolutionMethod::Gemm, numIterations, threadPool);
+        }
+
+        std::cout << std::setw(34) << layer.m_Name
+                  << std::setw(14) << std::fixed << std::setprecision(2) << directMs
+                  << std::setw(12) << gemmMs
+                  << std::setw(11) << directMs / gemmMs << "x" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,274 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+// Measures the speedup of the reference backend's Convolution2d, DepthwiseConvolution2d and FullyConnected kernels
+// with the number of threads they are split across (IRuntime::CreationOptions::m_CpuRefNumThreads).
+
+#include <armnn/ArmNN.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+namespace po = boost::program_options;
+
+struct LayerBenchmark
+{
+    std::string m_Name;
+    std::function<armnn::INetworkPtr()> m_CreateNetwork;
+};
+
+std::vector<float> MakeData(unsigned int numElements)
+{
+    std::vector<float> data(numElements);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<float>(static_cast<int>(i % 13) - 6) * 0.03f;
+    }
+    return data;
+}
+
+// Input -> layer -> Output, with the layer created by addLayer.
+armnn::INetworkPtr CreateSingleLayerNetwork(const armnn::TensorInfo& inputInfo,
+                                            const armnn::TensorInfo& outputInfo,
+                                            const std::function<armnn::IConnectableLayer*(armnn::INetwork&)>& addLayer)
+{
+    using namespace armnn;
+
+    INetworkPtr net(INetwork::Create());
+
+    IConnectableLayer* input  = net->AddInputLayer(0);
+    IConnectableLayer* layer  = addLayer(*net);
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(layer->GetInputSlot(0));
+    layer->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    layer->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+    return net;
+}
+
+std::vector<LayerBenchmark> CreateLayerBenchmarks(unsigned int size, unsigned int channels)
+{
+    using namespace armnn;
+
+    std::vector<LayerBenchmark> benchmarks;
+
+    benchmarks.push_back({ "Convolution2d 3x3", [=]()
+    {
+        TensorInfo tensorInfo({ 1, size, size, channels }, DataType::Float32);
+        TensorInfo weightsInfo({ channels, 3, 3, channels }, DataType::Float32);
+        TensorInfo biasInfo({ channels }, DataType::Float32);
+        const std::vector<float> weights = MakeData(weightsInfo.GetNumElements());
+        const std::vector<float> biases  = MakeData(biasInfo.GetNumElements());
+
+        Convolution2dDescriptor desc;
+        desc.m_PadLeft     = 1;
+        desc.m_PadRight    = 1;
+        desc.m_PadTop      = 1;
+        desc.m_PadBottom   = 1;
+        desc.m_StrideX     = 1;
+        desc.m_StrideY     = 1;
+        desc.m_BiasEnabled = true;
+        desc.m_DataLayout  = DataLayout::NHWC;
+
+        return CreateSingleLayerNetwork(tensorInfo, tensorInfo, [&](INetwork& net)
+        {
+            return net.AddConvolution2dLayer(desc,
+                                             ConstTensor(weightsInfo, weights),
+                                             Optional<ConstTensor>(ConstTensor(biasInfo, biases)));
+        });
+    }});
+
+    benchmarks.push_back({ "DepthwiseConvolution2d 3x3", [=]()
+    {
+        TensorInfo tensorInfo({ 1, size, size, channels }, DataType::Float32);
+        TensorInfo weightsInfo({ 1, channels, 3, 3 }, DataType::Float32);
+        TensorInfo biasInfo({ channels }, DataType::Float32);
+        const std::vector<float> weights = MakeData(weightsInfo.GetNumElements());
+        const std::vector<float> biases  = MakeData(biasInfo.GetNumElements());
+
+        DepthwiseConvolution2dDescriptor desc;
+        desc.m_PadLeft     = 1;
+        desc.m_PadRight    = 1;
+        desc.m_PadTop      = 1;
+        desc.m_PadBottom   = 1;
+        desc.m_StrideX     = 1;
+        desc.m_StrideY     = 1;
+        desc.m_BiasEnabled = true;
+        desc.m_DataLayout  = DataLayout::NHWC;
+
+        return CreateSingleLayerNetwork(tensorInfo, tensorInfo, [&](INetwork& net)
+        {
+            return net.AddDepthwiseConvolution2dLayer(desc,
+                                                      ConstTensor(weightsInfo, weights),
+                                                      Optional<ConstTensor>(ConstTensor(biasInfo, biases)));
+        });
+    }});
+
+    benchmarks.push_back({ "FullyConnected", [=]()
+    {
+        const unsigned int numInputs  = size * size;
+        const unsigned int numOutputs = channels * 16;
+        TensorInfo inputInfo({ 1, numInputs }, DataType::Float32);
+        TensorInfo outputInfo({ 1, numOutputs }, DataType::Float32);
+        TensorInfo weightsInfo({ numInputs, numOutputs }, DataType::Float32);
+        TensorInfo biasInfo({ numOutputs }, DataType::Float32);
+        const std::vector<float> weights = MakeData(weightsInfo.GetNumElements());
+        const std::vector<float> biases  = MakeData(biasInfo.GetNumElements());
+
+        FullyConnectedDescriptor desc;
+        desc.m_BiasEnabled = true;
+
+        return CreateSingleLayerNetwork(inputInfo, outputInfo, [&](INetwork& net)
+        {
+            return net.AddFullyConnectedLayer(desc,
+                                              ConstTensor(weightsInfo, weights),
+                                              Optional<ConstTensor>(ConstTensor(biasInfo, biases)));
+        });
+    }});
+
+    return benchmarks;
+}
+
+std::vector<unsigned int> ParseThreadCounts(const std::string& threadCounts)
+{
+    std::vector<unsigned int> result;
+    std::stringstream ss(threadCounts);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        const int count = std::stoi(item);
+        if (count > 0)
+        {
+            result.push_back(static_cast<unsigned int>(count));
+        }
+    }
+    return result;
+}
+
+// Returns the average duration of an inference of the network in milliseconds, or a negative value on failure.
+double MeasureInference(const LayerBenchmark& benchmark, unsigned int numThreads, unsigned int numIterations)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    options.m_CpuRefNumThreads = numThreads;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    INetworkPtr net = benchmark.m_CreateNetwork();
+    IOptimizedNetworkPtr optNet = Optimize(*net, { Compute::CpuRef }, runtime->GetDeviceSpec());
+    NetworkId networkId;
+    if (!optNet || runtime->LoadNetwork(networkId, std::move(optNet)) != Status::Success)
+    {
+        return -1.0;
+    }
+
+    const TensorInfo inputInfo  = runtime->GetInputTensorInfo(networkId, 0);
+    const TensorInfo outputInfo = runtime->GetOutputTensorInfo(networkId, 0);
+    std::vector<float> inputData = MakeData(inputInfo.GetNumElements());
+    std::vector<float> outputData(outputInfo.GetNumElements());
+
+    InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(outputInfo, outputData.data()) } };
+
+    // Warm up run, which also allocates the intermediate tensors.
+    runtime->EnqueueWorkload(networkId, inputTensors, outputTensors);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < numIterations; ++i)
+    {
+        runtime->EnqueueWorkload(networkId, inputTensors, outputTensors);
+    }
+    const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+
+    return elapsed.count() / numIterations;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    std::string threadCountsStr;
+    unsigned int numIterations = 0;
+    unsigned int size = 0;
+    unsigned int channels = 0;
+
+    po::options_description desc("Options");
+    desc.add_options()
+        ("help,h", "Display usage information")
+        ("threads,t", po::value<std::string>(&threadCountsStr)->default_value("1,2,4,8"),
+         "Comma separated list of the numbers of threads to measure")
+        ("iterations,i", po::value<unsigned int>(&numIterations)->default_value(10),
+         "Number of inferences timed for each layer and thread count")
+        ("size,s", po::value<unsigned int>(&size)->default_value(56), "Height and width of the input")
+        ("channels,c", po::value<unsigned int>(&channels)->default_value(32), "Number of channels");
+
+    po::variables_map vm;
+    try
+    {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        if (vm.count("help"))
+        {
+            std::cout << desc << std::endl;
+            return EXIT_SUCCESS;
+        }
+        po::notify(vm);
+    }
+    catch (const po::error& e)
+    {
+        std::cerr << e.what() << std::endl << desc << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::vector<unsigned int> threadCounts = ParseThreadCounts(threadCountsStr);
+    if (threadCounts.empty() || numIterations == 0)
+    {
+        std::cerr << "At least one thread count and one iteration are needed" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Input " << size << "x" << size << "x" << channels << ", " << numIterations
+              << " inferences per measurement" << std::endl;
+    std::cout << "Speedups are relative to the first thread count measured for each layer" << std::endl;
+    std::cout << std::setw(28) << "layer" << std::setw(10) << "threads"
+              << std::setw(12) << "ms" << std::setw(12) << "speedup" << std::endl;
+
+    for (const LayerBenchmark& benchmark : CreateLayerBenchmarks(size, channels))
+    {
+        double baselineMs = 0.0;
+        for (unsigned int numThreads : threadCounts)
+        {
+            const double ms = MeasureInference(benchmark, numThreads, numIterations);
+            if (ms < 0.0)
+            {
+                std::cerr << "Failed to load the " << benchmark.m_Name << " network" << std::endl;
+                return EXIT_FAILURE;
+            }
+            if (baselineMs == 0.0)
+            {
+                baselineMs = ms;
+            }
+
+            std::cout << std::setw(28) << benchmark.m_Name << std::setw(10) << numThreads
+                      << std::setw(12) << std::fixed << std::setprecision(3) << ms
+                      << std::setw(11) << std::setprecision(2) << baselineMs / ms << "x" << std::endl;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}